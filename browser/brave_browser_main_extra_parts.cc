@@ -76,3 +76,10 @@ void BraveBrowserMainExtraParts::PreMainMessageLoopRun() {
   brave::BraveUptimeTracker::CreateInstance(g_browser_process->local_state());
 #endif  // !BUILDFLAG(IS_ANDROID)
 }
+
+void BraveBrowserMainExtraParts::PostMainMessageLoopRun() {
+#if BUILDFLAG(BRAVE_P3A_ENABLED)
+  // Local state is committed to disk when the browser process tears down.
+  g_brave_browser_process->brave_p3a_service()->PersistPendingUpdates();
+#endif  // BUILDFLAG(BRAVE_P3A_ENABLED)
+}
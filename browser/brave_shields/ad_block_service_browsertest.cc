@@ -18,6 +18,7 @@
 #include "base/task/post_task.h"
 #include "base/test/thread_test_helper.h"
 #include "brave/browser/brave_browser_process.h"
+#include "brave/browser/brave_shields/brave_shields_web_contents_observer.h"
 #include "brave/browser/net/brave_ad_block_tp_network_delegate_helper.h"
 #include "brave/common/brave_paths.h"
 #include "brave/common/pref_names.h"
@@ -91,6 +92,9 @@ AdBlockServiceTest::~AdBlockServiceTest() {}
 void AdBlockServiceTest::SetUpOnMainThread() {
   ExtensionBrowserTest::SetUpOnMainThread();
   host_resolver()->AddRule("*", "127.0.0.1");
+  // Stats counters are checked right after each block.
+  brave_shields::BraveShieldsWebContentsObserver::
+      SetBlockedEventsFlushDelayForTesting(base::TimeDelta());
 }
 
 void AdBlockServiceTest::SetUp() {
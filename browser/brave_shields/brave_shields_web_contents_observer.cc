@@ -9,6 +9,7 @@
 #include <string>
 #include <utility>
 
+#include "base/bind.h"
 #include "base/feature_list.h"
 #include "base/strings/utf_string_conversions.h"
 #include "brave/common/pref_names.h"
@@ -33,6 +34,7 @@
 #include "extensions/buildflags/buildflags.h"
 #include "ipc/ipc_message_macros.h"
 #include "mojo/public/cpp/bindings/associated_remote.h"
+#include "third_party/abseil-cpp/absl/types/optional.h"
 #include "third_party/blink/public/common/associated_interfaces/associated_interface_provider.h"
 
 #if BUILDFLAG(ENABLE_EXTENSIONS)
@@ -58,6 +60,34 @@ namespace {
 
 BraveShieldsWebContentsObserver* g_receiver_impl_for_testing = nullptr;
 
+// Blocked events are handed to extensions and the Shields panel at most ten
+// times per second, which is still quick enough for the panel to look live.
+// The stats counters are only shown on the NTP, so their writes can lag more.
+constexpr base::TimeDelta kBlockedEventsFlushDelay = base::Milliseconds(100);
+constexpr base::TimeDelta kBlockedCountersFlushDelay = base::Seconds(5);
+
+absl::optional<base::TimeDelta> g_flush_delay_for_testing;
+
+base::TimeDelta GetBlockedEventsFlushDelay() {
+  return g_flush_delay_for_testing.value_or(kBlockedEventsFlushDelay);
+}
+
+base::TimeDelta GetBlockedCountersFlushDelay() {
+  return g_flush_delay_for_testing.value_or(kBlockedCountersFlushDelay);
+}
+
+const char* GetStatsPrefNameForBlockType(const std::string& block_type) {
+  if (block_type == kAds)
+    return kAdsBlocked;
+  if (block_type == kHTTPUpgradableResources)
+    return kHttpsUpgrades;
+  if (block_type == kJavaScript)
+    return kJavascriptBlocked;
+  if (block_type == kFingerprintingV2)
+    return kFingerprintingBlocked;
+  return nullptr;
+}
+
 // Content Settings are only sent to the main frame currently. Chrome may fix
 // this at some point, but for now we do this as a work-around. You can verify
 // if this is fixed by running the following test: npm run test --
@@ -178,29 +208,19 @@ void BraveShieldsWebContentsObserver::DispatchBlockedEvent(
   auto subresource = request_url.spec();
   WebContents* web_contents =
       WebContents::FromFrameTreeNodeId(frame_tree_node_id);
-  DispatchBlockedEventForWebContents(block_type, subresource, web_contents);
 
   if (web_contents) {
     BraveShieldsWebContentsObserver* observer =
         BraveShieldsWebContentsObserver::FromWebContents(web_contents);
-    if (observer && !observer->IsBlockedSubresource(subresource)) {
-      observer->AddBlockedSubresource(subresource);
-      PrefService* prefs =
-          Profile::FromBrowserContext(web_contents->GetBrowserContext())
-              ->GetOriginalProfile()
-              ->GetPrefs();
-
-      if (block_type == kAds) {
-        prefs->SetUint64(kAdsBlocked, prefs->GetUint64(kAdsBlocked) + 1);
-      } else if (block_type == kHTTPUpgradableResources) {
-        prefs->SetUint64(kHttpsUpgrades, prefs->GetUint64(kHttpsUpgrades) + 1);
-      } else if (block_type == kJavaScript) {
-        prefs->SetUint64(kJavascriptBlocked,
-                         prefs->GetUint64(kJavascriptBlocked) + 1);
-      } else if (block_type == kFingerprintingV2) {
-        prefs->SetUint64(kFingerprintingBlocked,
-                         prefs->GetUint64(kFingerprintingBlocked) + 1);
+    if (observer) {
+      observer->AddBlockedEvent(block_type, subresource);
+      if (!observer->IsBlockedSubresource(subresource)) {
+        observer->AddBlockedSubresource(subresource);
+        observer->CountBlockedSubresource(block_type);
       }
+    } else {
+      DispatchBlockedEventsForWebContents({{block_type, subresource}},
+                                          web_contents);
     }
   }
   brave_perf_predictor::PerfPredictorTabHelper::DispatchBlockedEvent(
@@ -209,36 +229,34 @@ void BraveShieldsWebContentsObserver::DispatchBlockedEvent(
 
 #if !BUILDFLAG(IS_ANDROID)
 // static
-void BraveShieldsWebContentsObserver::DispatchBlockedEventForWebContents(
-    const std::string& block_type,
-    const std::string& subresource,
+void BraveShieldsWebContentsObserver::DispatchBlockedEventsForWebContents(
+    const BlockedEvents& events,
     WebContents* web_contents) {
-#if BUILDFLAG(ENABLE_EXTENSIONS)
-  if (!web_contents) {
+  if (!web_contents || events.empty()) {
     return;
   }
+#if BUILDFLAG(ENABLE_EXTENSIONS)
   EventRouter* event_router =
       EventRouter::Get(web_contents->GetBrowserContext());
   if (event_router) {
-    extensions::api::brave_shields::OnBlocked::Details details;
-    details.tab_id = extensions::ExtensionTabUtil::GetTabId(web_contents);
-    details.block_type = block_type;
-    details.subresource = subresource;
-    std::unique_ptr<Event> event(
-        new Event(extensions::events::BRAVE_AD_BLOCKED,
-                  extensions::api::brave_shields::OnBlocked::kEventName,
-                  extensions::api::brave_shields::OnBlocked::Create(details)));
-    event_router->BroadcastEvent(std::move(event));
+    const int tab_id = extensions::ExtensionTabUtil::GetTabId(web_contents);
+    for (const auto& blocked_event : events) {
+      extensions::api::brave_shields::OnBlocked::Details details;
+      details.tab_id = tab_id;
+      details.block_type = blocked_event.first;
+      details.subresource = blocked_event.second;
+      std::unique_ptr<Event> event(new Event(
+          extensions::events::BRAVE_AD_BLOCKED,
+          extensions::api::brave_shields::OnBlocked::kEventName,
+          extensions::api::brave_shields::OnBlocked::Create(details)));
+      event_router->BroadcastEvent(std::move(event));
+    }
   }
 #endif
   if (base::FeatureList::IsEnabled(
           brave_shields::features::kBraveShieldsPanelV2)) {
-#if !BUILDFLAG(IS_ANDROID)
-    if (!web_contents)
-      return;
     brave_shields::BraveShieldsDataController::FromWebContents(web_contents)
-        ->HandleItemBlocked(block_type, subresource);
-#endif
+        ->HandleItemsBlocked(events);
   }
 }
 #endif
@@ -250,8 +268,68 @@ void BraveShieldsWebContentsObserver::OnJavaScriptBlocked(
   if (!web_contents)
     return;
 
-  DispatchBlockedEventForWebContents(brave_shields::kJavaScript,
-                                     base::UTF16ToUTF8(details), web_contents);
+  BraveShieldsWebContentsObserver* observer =
+      BraveShieldsWebContentsObserver::FromWebContents(web_contents);
+  if (!observer) {
+    DispatchBlockedEventsForWebContents(
+        {{brave_shields::kJavaScript, base::UTF16ToUTF8(details)}},
+        web_contents);
+    return;
+  }
+  observer->AddBlockedEvent(brave_shields::kJavaScript,
+                            base::UTF16ToUTF8(details));
+}
+
+void BraveShieldsWebContentsObserver::AddBlockedEvent(
+    const std::string& block_type,
+    const std::string& subresource) {
+  pending_blocked_events_.emplace_back(block_type, subresource);
+  if (!blocked_events_timer_.IsRunning()) {
+    blocked_events_timer_.Start(
+        FROM_HERE, GetBlockedEventsFlushDelay(),
+        base::BindOnce(&BraveShieldsWebContentsObserver::FlushBlockedEvents,
+                       base::Unretained(this)));
+  }
+}
+
+void BraveShieldsWebContentsObserver::CountBlockedSubresource(
+    const std::string& block_type) {
+  const char* pref_name = GetStatsPrefNameForBlockType(block_type);
+  if (!pref_name)
+    return;
+
+  pending_counter_deltas_[pref_name]++;
+  if (!blocked_counters_timer_.IsRunning()) {
+    blocked_counters_timer_.Start(
+        FROM_HERE, GetBlockedCountersFlushDelay(),
+        base::BindOnce(&BraveShieldsWebContentsObserver::FlushBlockedCounters,
+                       base::Unretained(this)));
+  }
+}
+
+void BraveShieldsWebContentsObserver::FlushBlockedEvents() {
+  blocked_events_timer_.Stop();
+  if (pending_blocked_events_.empty())
+    return;
+
+  BlockedEvents events;
+  events.swap(pending_blocked_events_);
+  DispatchBlockedEventsForWebContents(events, web_contents());
+}
+
+void BraveShieldsWebContentsObserver::FlushBlockedCounters() {
+  blocked_counters_timer_.Stop();
+  if (pending_counter_deltas_.empty() || !web_contents())
+    return;
+
+  PrefService* prefs =
+      Profile::FromBrowserContext(web_contents()->GetBrowserContext())
+          ->GetOriginalProfile()
+          ->GetPrefs();
+  for (const auto& delta : pending_counter_deltas_) {
+    prefs->SetUint64(delta.first, prefs->GetUint64(delta.first) + delta.second);
+  }
+  pending_counter_deltas_.clear();
 }
 
 // static
@@ -270,6 +348,9 @@ void BraveShieldsWebContentsObserver::ReadyToCommitNavigation(
   content::ReloadType reload_type = navigation_handle->GetReloadType();
   if (navigation_handle->IsInMainFrame() &&
       !navigation_handle->IsSameDocument()) {
+    // Deliver the previous page's blocked events before the Shields panel
+    // resets its lists for the new page.
+    FlushBlockedEvents();
     if (reload_type == content::ReloadType::NONE) {
       // For new loads, we reset the counters for both blocked scripts and URLs.
       allowed_script_origins_.clear();
@@ -301,6 +382,13 @@ void BraveShieldsWebContentsObserver::ReadyToCommitNavigation(
           base::Unretained(this)));
 }
 
+void BraveShieldsWebContentsObserver::WebContentsDestroyed() {
+  // Nobody is left to show the pending events, but the stats still count.
+  blocked_events_timer_.Stop();
+  pending_blocked_events_.clear();
+  FlushBlockedCounters();
+}
+
 void BraveShieldsWebContentsObserver::AllowScriptsOnce(
     const std::vector<std::string>& origins,
     WebContents* contents) {
@@ -313,6 +401,12 @@ void BraveShieldsWebContentsObserver::SetReceiverImplForTesting(
   g_receiver_impl_for_testing = impl;
 }
 
+// static
+void BraveShieldsWebContentsObserver::SetBlockedEventsFlushDelayForTesting(
+    base::TimeDelta delay) {
+  g_flush_delay_for_testing = delay;
+}
+
 void BraveShieldsWebContentsObserver::BindReceiver(
     mojo::PendingAssociatedReceiver<brave_shields::mojom::BraveShieldsHost>
         receiver,
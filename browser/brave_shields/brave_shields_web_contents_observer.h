@@ -9,10 +9,13 @@
 #include <map>
 #include <set>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "base/containers/flat_map.h"
 #include "base/synchronization/lock.h"
+#include "base/time/time.h"
+#include "base/timer/timer.h"
 #include "brave/components/brave_shields/common/brave_shields.mojom.h"
 #include "content/public/browser/render_frame_host_receiver_set.h"
 #include "content/public/browser/web_contents_observer.h"
@@ -31,6 +34,9 @@ class BraveShieldsWebContentsObserver
       public content::WebContentsUserData<BraveShieldsWebContentsObserver>,
       public brave_shields::mojom::BraveShieldsHost {
  public:
+  // Pairs of (block type, subresource).
+  using BlockedEvents = std::vector<std::pair<std::string, std::string>>;
+
   explicit BraveShieldsWebContentsObserver(content::WebContents*);
   BraveShieldsWebContentsObserver(const BraveShieldsWebContentsObserver&) =
       delete;
@@ -44,14 +50,16 @@ class BraveShieldsWebContentsObserver
       content::RenderFrameHost* rfh);
 
   static void RegisterProfilePrefs(PrefRegistrySimple* registry);
-  static void DispatchBlockedEventForWebContents(
-      const std::string& block_type,
-      const std::string& subresource,
+  static void DispatchBlockedEventsForWebContents(
+      const BlockedEvents& events,
       content::WebContents* web_contents);
   static void DispatchBlockedEvent(const GURL& request_url,
                                    int frame_tree_node_id,
                                    const std::string& block_type);
   static GURL GetTabURLFromRenderFrameInfo(int render_frame_tree_node_id);
+  // Overrides the delay used to coalesce blocked events and stats counter
+  // updates, so that tests can observe them without waiting.
+  static void SetBlockedEventsFlushDelayForTesting(base::TimeDelta delay);
   void AllowScriptsOnce(const std::vector<std::string>& origins,
                         content::WebContents* web_contents);
   bool IsBlockedSubresource(const std::string& subresource);
@@ -65,6 +73,7 @@ class BraveShieldsWebContentsObserver
                               content::RenderFrameHost* new_host) override;
   void ReadyToCommitNavigation(
       content::NavigationHandle* navigation_handle) override;
+  void WebContentsDestroyed() override;
 
   // brave_shields::mojom::BraveShieldsHost.
   void OnJavaScriptBlocked(const std::u16string& details) override;
@@ -81,6 +90,15 @@ class BraveShieldsWebContentsObserver
   // other than this own class, for testing purposes only.
   static void SetReceiverImplForTesting(BraveShieldsWebContentsObserver* impl);
 
+  // Blocked events arrive once per blocked subresource, so they are buffered
+  // here and handed to extensions and the Shields panel in batches, and the
+  // stats counters are written to prefs as accumulated deltas.
+  void AddBlockedEvent(const std::string& block_type,
+                       const std::string& subresource);
+  void CountBlockedSubresource(const std::string& block_type);
+  void FlushBlockedEvents();
+  void FlushBlockedCounters();
+
   // Only used from the BindBraveShieldsHost() static method, useful to bind the
   // mojo receiver of brave_shields::mojom::BraveShieldsHost to a different
   // implementor when needed, for testing purposes.
@@ -98,6 +116,12 @@ class BraveShieldsWebContentsObserver
   // continually tries to load the same blocked URLs.
   std::set<std::string> blocked_url_paths_;
 
+  BlockedEvents pending_blocked_events_;
+  base::OneShotTimer blocked_events_timer_;
+  // Maps stats pref names to the number of blocks not yet written to prefs.
+  base::flat_map<std::string, uint64_t> pending_counter_deltas_;
+  base::OneShotTimer blocked_counters_timer_;
+
   content::RenderFrameHostReceiverSet<brave_shields::mojom::BraveShieldsHost>
       receivers_;
 
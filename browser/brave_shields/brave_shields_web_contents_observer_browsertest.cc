@@ -3,10 +3,18 @@
  * License, v. 2.0. If a copy of the MPL was not distributed with this file,
  * You can obtain one at http://mozilla.org/MPL/2.0/. */
 
+#include <string>
+#include <vector>
+
 #include "base/memory/raw_ptr.h"
 #include "base/path_service.h"
+#include "base/test/scoped_feature_list.h"
 #include "brave/browser/brave_shields/brave_shields_web_contents_observer.h"
+#include "brave/browser/ui/brave_shields_data_controller.h"
 #include "brave/common/brave_paths.h"
+#include "brave/common/pref_names.h"
+#include "brave/components/brave_shields/common/brave_shield_constants.h"
+#include "brave/components/brave_shields/common/features.h"
 #include "chrome/browser/content_settings/host_content_settings_map_factory.h"
 #include "chrome/browser/profiles/profile.h"
 #include "chrome/browser/ui/browser.h"
@@ -16,9 +24,12 @@
 #include "components/content_settings/core/browser/host_content_settings_map.h"
 #include "components/content_settings/core/common/content_settings.h"
 #include "components/content_settings/core/common/content_settings_types.h"
+#include "components/prefs/pref_service.h"
+#include "content/public/browser/render_frame_host.h"
 #include "content/public/browser/web_contents.h"
 #include "content/public/test/browser_test.h"
 #include "content/public/test/browser_test_utils.h"
+#include "content/public/test/test_utils.h"
 #include "net/dns/mock_host_resolver.h"
 #include "url/gurl.h"
 
@@ -47,6 +58,27 @@ class TestBraveShieldsWebContentsObserver
   int block_javascript_count_ = 0;
 };
 
+// Records the Shields panel's blocked count each time it is notified.
+class BlockedCountRecorder : public BraveShieldsDataController::Observer {
+ public:
+  explicit BlockedCountRecorder(BraveShieldsDataController* controller)
+      : controller_(controller) {
+    controller_->AddObserver(this);
+  }
+  ~BlockedCountRecorder() { controller_->RemoveObserver(this); }
+
+  // BraveShieldsDataController::Observer.
+  void OnResourcesChanged() override {
+    counts_.push_back(controller_->GetTotalBlockedCount());
+  }
+
+  const std::vector<int>& counts() const { return counts_; }
+
+ private:
+  raw_ptr<BraveShieldsDataController> controller_ = nullptr;
+  std::vector<int> counts_;
+};
+
 }  // namespace
 
 class BraveShieldsWebContentsObserverBrowserTest : public InProcessBrowserTest {
@@ -93,6 +125,39 @@ class BraveShieldsWebContentsObserverBrowserTest : public InProcessBrowserTest {
     return brave_shields_web_contents_observer_;
   }
 
+  // Reports an ad blocked in the main frame of |web_contents| the way the
+  // network stack does.
+  void DispatchAdBlocked(content::WebContents* web_contents,
+                         const std::string& path) {
+    BraveShieldsWebContentsObserver::DispatchBlockedEvent(
+        embedded_test_server()->GetURL("ads.com", path),
+        web_contents->GetMainFrame()->GetFrameTreeNodeId(), kAds);
+  }
+
+  size_t GetPendingBlockedEventsCount(content::WebContents* web_contents) {
+    return BraveShieldsWebContentsObserver::FromWebContents(web_contents)
+        ->pending_blocked_events_.size();
+  }
+
+  bool IsBlockedEventsTimerRunning(content::WebContents* web_contents) {
+    return BraveShieldsWebContentsObserver::FromWebContents(web_contents)
+        ->blocked_events_timer_.IsRunning();
+  }
+
+  void FireBlockedEventsTimer(content::WebContents* web_contents) {
+    BraveShieldsWebContentsObserver::FromWebContents(web_contents)
+        ->blocked_events_timer_.FireNow();
+  }
+
+  void FireBlockedCountersTimer(content::WebContents* web_contents) {
+    BraveShieldsWebContentsObserver::FromWebContents(web_contents)
+        ->blocked_counters_timer_.FireNow();
+  }
+
+  uint64_t GetAdsBlockedPref() {
+    return browser()->profile()->GetPrefs()->GetUint64(kAdsBlocked);
+  }
+
  private:
   raw_ptr<HostContentSettingsMap> content_settings_ = nullptr;
   raw_ptr<TestBraveShieldsWebContentsObserver>
@@ -164,4 +229,100 @@ IN_PROC_BROWSER_TEST_F(BraveShieldsWebContentsObserverBrowserTest,
   EXPECT_GT(brave_shields_web_contents_observer()->block_javascript_count(), 0);
 }
 
+// Keeps the flush timers from firing on their own, so that each test decides
+// when a batch is delivered.
+class BraveShieldsBlockedEventsBrowserTest
+    : public BraveShieldsWebContentsObserverBrowserTest {
+ public:
+  BraveShieldsBlockedEventsBrowserTest() {
+    feature_list_.InitAndEnableFeature(features::kBraveShieldsPanelV2);
+  }
+
+  void SetUpOnMainThread() override {
+    BraveShieldsWebContentsObserverBrowserTest::SetUpOnMainThread();
+    BraveShieldsWebContentsObserver::SetBlockedEventsFlushDelayForTesting(
+        base::Hours(1));
+  }
+
+ private:
+  base::test::ScopedFeatureList feature_list_;
+};
+
+IN_PROC_BROWSER_TEST_F(BraveShieldsBlockedEventsBrowserTest,
+                       BlockedEventsAreBatched) {
+  EXPECT_TRUE(ui_test_utils::NavigateToURL(
+      browser(), embedded_test_server()->GetURL("a.com", "/simple.html")));
+  content::WebContents* web_contents = GetWebContents();
+  BlockedCountRecorder recorder(
+      BraveShieldsDataController::FromWebContents(web_contents));
+  const uint64_t ads_blocked = GetAdsBlockedPref();
+
+  DispatchAdBlocked(web_contents, "/ad1.js");
+  DispatchAdBlocked(web_contents, "/ad2.js");
+  DispatchAdBlocked(web_contents, "/ad3.js");
+  // A repeated subresource is shown again but only counted once.
+  DispatchAdBlocked(web_contents, "/ad3.js");
+
+  // Nothing is delivered until the timer fires.
+  EXPECT_EQ(GetPendingBlockedEventsCount(web_contents), 4u);
+  EXPECT_TRUE(IsBlockedEventsTimerRunning(web_contents));
+  EXPECT_TRUE(recorder.counts().empty());
+  EXPECT_EQ(GetAdsBlockedPref(), ads_blocked);
+
+  // The whole batch reaches the panel with a single notification.
+  FireBlockedEventsTimer(web_contents);
+  EXPECT_EQ(recorder.counts(), std::vector<int>({3}));
+  EXPECT_EQ(GetPendingBlockedEventsCount(web_contents), 0u);
+  EXPECT_FALSE(IsBlockedEventsTimerRunning(web_contents));
+
+  // The stats counter is written as a single accumulated delta.
+  EXPECT_EQ(GetAdsBlockedPref(), ads_blocked);
+  FireBlockedCountersTimer(web_contents);
+  EXPECT_EQ(GetAdsBlockedPref(), ads_blocked + 3);
+}
+
+IN_PROC_BROWSER_TEST_F(BraveShieldsBlockedEventsBrowserTest,
+                       BlockedEventsAreFlushedOnNavigation) {
+  EXPECT_TRUE(ui_test_utils::NavigateToURL(
+      browser(), embedded_test_server()->GetURL("a.com", "/simple.html")));
+  content::WebContents* web_contents = GetWebContents();
+  BlockedCountRecorder recorder(
+      BraveShieldsDataController::FromWebContents(web_contents));
+
+  DispatchAdBlocked(web_contents, "/ad1.js");
+  DispatchAdBlocked(web_contents, "/ad2.js");
+  EXPECT_TRUE(recorder.counts().empty());
+
+  // The previous page's events are delivered before the panel resets its
+  // lists for the new page, and no timer is left behind.
+  EXPECT_TRUE(ui_test_utils::NavigateToURL(
+      browser(), embedded_test_server()->GetURL("b.com", "/simple.html")));
+  EXPECT_EQ(recorder.counts(), std::vector<int>({2, 0}));
+  EXPECT_EQ(GetPendingBlockedEventsCount(web_contents), 0u);
+  EXPECT_FALSE(IsBlockedEventsTimerRunning(web_contents));
+}
+
+IN_PROC_BROWSER_TEST_F(BraveShieldsBlockedEventsBrowserTest,
+                       BlockedCountersAreFlushedOnWebContentsDestruction) {
+  ui_test_utils::NavigateToURLWithDisposition(
+      browser(), embedded_test_server()->GetURL("a.com", "/simple.html"),
+      WindowOpenDisposition::NEW_FOREGROUND_TAB,
+      ui_test_utils::BROWSER_TEST_WAIT_FOR_LOAD_STOP);
+  content::WebContents* web_contents = GetWebContents();
+  const uint64_t ads_blocked = GetAdsBlockedPref();
+
+  DispatchAdBlocked(web_contents, "/ad1.js");
+  DispatchAdBlocked(web_contents, "/ad2.js");
+  EXPECT_EQ(GetAdsBlockedPref(), ads_blocked);
+
+  // Closing the tab drops the events nobody can see, but still writes the
+  // stats counters.
+  content::WebContentsDestroyedWatcher destroyed_watcher(web_contents);
+  TabStripModel* tab_strip_model = browser()->tab_strip_model();
+  tab_strip_model->CloseWebContentsAt(tab_strip_model->active_index(),
+                                      TabStripModel::CLOSE_NONE);
+  destroyed_watcher.Wait();
+  EXPECT_EQ(GetAdsBlockedPref(), ads_blocked + 2);
+}
+
 }  // namespace brave_shields
@@ -0,0 +1,51 @@
+/* Copyright (c) 2022 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "brave/browser/brave_shields/shields_settings_cache_factory.h"
+
+#include "brave/components/brave_shields/browser/shields_settings_cache.h"
+#include "chrome/browser/content_settings/host_content_settings_map_factory.h"
+#include "chrome/browser/profiles/incognito_helpers.h"
+#include "chrome/browser/profiles/profile.h"
+#include "components/keyed_service/content/browser_context_dependency_manager.h"
+
+namespace brave_shields {
+
+// static
+ShieldsSettingsCache* ShieldsSettingsCacheFactory::GetForBrowserContext(
+    content::BrowserContext* context) {
+  return static_cast<ShieldsSettingsCache*>(
+      GetInstance()->GetServiceForBrowserContext(context,
+                                                 /*create_service=*/true));
+}
+
+// static
+ShieldsSettingsCacheFactory* ShieldsSettingsCacheFactory::GetInstance() {
+  return base::Singleton<ShieldsSettingsCacheFactory>::get();
+}
+
+ShieldsSettingsCacheFactory::ShieldsSettingsCacheFactory()
+    : BrowserContextKeyedServiceFactory(
+          "ShieldsSettingsCache",
+          BrowserContextDependencyManager::GetInstance()) {
+  DependsOn(HostContentSettingsMapFactory::GetInstance());
+}
+
+ShieldsSettingsCacheFactory::~ShieldsSettingsCacheFactory() = default;
+
+KeyedService* ShieldsSettingsCacheFactory::BuildServiceInstanceFor(
+    content::BrowserContext* context) const {
+  return new ShieldsSettingsCache(
+      HostContentSettingsMapFactory::GetForProfile(
+          Profile::FromBrowserContext(context)));
+}
+
+content::BrowserContext* ShieldsSettingsCacheFactory::GetBrowserContextToUse(
+    content::BrowserContext* context) const {
+  // Incognito has its own content settings.
+  return chrome::GetBrowserContextOwnInstanceInIncognito(context);
+}
+
+}  // namespace brave_shields
@@ -0,0 +1,178 @@
+/* Copyright (c) 2022 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/decentralized_dns/resolution_cache.h"
+
+#include <string>
+#include <utility>
+
+#include "base/bind.h"
+#include "base/containers/circular_deque.h"
+#include "base/test/simple_test_tick_clock.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace decentralized_dns {
+
+namespace {
+
+constexpr char kHost[] = "brave.crypto";
+
+}  // namespace
+
+class ResolutionCacheUnitTest : public testing::Test {
+ public:
+  ResolutionCacheUnitTest() : cache_(&tick_clock_) {}
+  ~ResolutionCacheUnitTest() override = default;
+
+  // Starts a lookup whose resolve is held in |pending_resolves_| until
+  // CompleteResolve() is called.
+  void StartResolve(const std::string& host) {
+    cache_.Resolve(host,
+                   base::BindOnce(&ResolutionCacheUnitTest::OnResolve,
+                                  base::Unretained(this)),
+                   base::BindOnce(&ResolutionCacheUnitTest::OnResult,
+                                  base::Unretained(this)));
+  }
+
+  // Completes the oldest lookup that is still in flight.
+  void CompleteResolve(bool success, const ResolutionCache::Records& records) {
+    ASSERT_FALSE(pending_resolves_.empty());
+    ResolutionCache::ResolveCallback callback =
+        std::move(pending_resolves_.front());
+    pending_resolves_.pop_front();
+    std::move(callback).Run(success, records);
+  }
+
+  ResolutionCache* cache() { return &cache_; }
+  base::SimpleTestTickClock* tick_clock() { return &tick_clock_; }
+  int resolve_count() const { return resolve_count_; }
+  int result_count() const { return result_count_; }
+  bool last_success() const { return last_success_; }
+  const ResolutionCache::Records& last_records() const {
+    return last_records_;
+  }
+
+ private:
+  void OnResolve(ResolutionCache::ResolveCallback callback) {
+    resolve_count_++;
+    pending_resolves_.push_back(std::move(callback));
+  }
+
+  void OnResult(bool success, const ResolutionCache::Records& records) {
+    result_count_++;
+    last_success_ = success;
+    last_records_ = records;
+  }
+
+  base::SimpleTestTickClock tick_clock_;
+  ResolutionCache cache_;
+  base::circular_deque<ResolutionCache::ResolveCallback> pending_resolves_;
+  int resolve_count_ = 0;
+  int result_count_ = 0;
+  bool last_success_ = false;
+  ResolutionCache::Records last_records_;
+};
+
+TEST_F(ResolutionCacheUnitTest, CachesSuccessfulResolution) {
+  StartResolve(kHost);
+  CompleteResolve(true, {"ipfs://hash"});
+  EXPECT_EQ(resolve_count(), 1);
+  EXPECT_EQ(result_count(), 1);
+  EXPECT_TRUE(last_success());
+
+  bool success = false;
+  ResolutionCache::Records records;
+  EXPECT_TRUE(cache()->GetCached(kHost, &success, &records));
+  EXPECT_TRUE(success);
+  EXPECT_EQ(records, ResolutionCache::Records({"ipfs://hash"}));
+
+  // A second lookup is answered from the cache without resolving again.
+  StartResolve(kHost);
+  EXPECT_EQ(resolve_count(), 1);
+  EXPECT_EQ(result_count(), 2);
+  EXPECT_EQ(last_records(), ResolutionCache::Records({"ipfs://hash"}));
+
+  EXPECT_FALSE(cache()->GetCached("other.crypto", &success, &records));
+}
+
+TEST_F(ResolutionCacheUnitTest, ExpiresAfterTTL) {
+  StartResolve(kHost);
+  CompleteResolve(true, {"ipfs://hash"});
+
+  bool success = false;
+  ResolutionCache::Records records;
+  tick_clock()->Advance(ResolutionCache::kTTL - base::Seconds(1));
+  EXPECT_TRUE(cache()->GetCached(kHost, &success, &records));
+
+  tick_clock()->Advance(base::Seconds(1));
+  EXPECT_FALSE(cache()->GetCached(kHost, &success, &records));
+
+  StartResolve(kHost);
+  EXPECT_EQ(resolve_count(), 2);
+}
+
+TEST_F(ResolutionCacheUnitTest, FailuresUseNegativeTTL) {
+  StartResolve(kHost);
+  CompleteResolve(false, {});
+  EXPECT_FALSE(last_success());
+
+  bool success = true;
+  ResolutionCache::Records records;
+  EXPECT_TRUE(cache()->GetCached(kHost, &success, &records));
+  EXPECT_FALSE(success);
+
+  tick_clock()->Advance(ResolutionCache::kNegativeTTL);
+  EXPECT_FALSE(cache()->GetCached(kHost, &success, &records));
+}
+
+TEST_F(ResolutionCacheUnitTest, CoalescesConcurrentLookups) {
+  StartResolve(kHost);
+  StartResolve(kHost);
+  StartResolve(kHost);
+  EXPECT_EQ(resolve_count(), 1);
+  EXPECT_EQ(result_count(), 0);
+
+  CompleteResolve(true, {"ipfs://hash"});
+  EXPECT_EQ(resolve_count(), 1);
+  EXPECT_EQ(result_count(), 3);
+  EXPECT_EQ(last_records(), ResolutionCache::Records({"ipfs://hash"}));
+}
+
+TEST_F(ResolutionCacheUnitTest, ClearDropsInFlightResult) {
+  StartResolve(kHost);
+  cache()->Clear();
+  CompleteResolve(true, {"ipfs://hash"});
+
+  // Waiting callers still get the result, but it isn't cached.
+  EXPECT_EQ(result_count(), 1);
+  bool success = false;
+  ResolutionCache::Records records;
+  EXPECT_FALSE(cache()->GetCached(kHost, &success, &records));
+}
+
+TEST_F(ResolutionCacheUnitTest, LookupsAfterClearStartFresh) {
+  StartResolve(kHost);
+  cache()->Clear();
+
+  // A caller arriving after the clear doesn't join the stale lookup.
+  StartResolve(kHost);
+  EXPECT_EQ(resolve_count(), 2);
+
+  // The stale lookup only answers the caller that was waiting on it.
+  CompleteResolve(true, {"ipfs://stale"});
+  EXPECT_EQ(result_count(), 1);
+  EXPECT_EQ(last_records(), ResolutionCache::Records({"ipfs://stale"}));
+
+  CompleteResolve(true, {"ipfs://fresh"});
+  EXPECT_EQ(result_count(), 2);
+  EXPECT_EQ(last_records(), ResolutionCache::Records({"ipfs://fresh"}));
+
+  bool success = false;
+  ResolutionCache::Records records;
+  EXPECT_TRUE(cache()->GetCached(kHost, &success, &records));
+  EXPECT_EQ(records, ResolutionCache::Records({"ipfs://fresh"}));
+}
+
+}  // namespace decentralized_dns
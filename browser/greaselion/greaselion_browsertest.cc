@@ -25,6 +25,7 @@
 #include "chrome/test/base/ui_test_utils.h"
 #include "content/public/test/browser_test.h"
 #include "content/public/test/browser_test_utils.h"
+#include "extensions/browser/extension_registry.h"
 #include "net/dns/mock_host_resolver.h"
 #include "ui/base/ui_base_switches.h"
 
@@ -369,6 +370,32 @@ IN_PROC_BROWSER_TEST_F(GreaselionServiceTest, IsNotGreaselionExtension) {
   EXPECT_FALSE(greaselion_service->IsGreaselionExtension("INVALID"));
 }
 
+// Reloading an identical configuration (e.g. an in-place component update that
+// ships the same rules) must not reinstall the extensions it was converted to.
+IN_PROC_BROWSER_TEST_F(GreaselionServiceTest, UnchangedRulesNotReinstalled) {
+  ASSERT_TRUE(InstallMockExtension());
+
+  GreaselionService* greaselion_service =
+      GreaselionServiceFactory::GetForBrowserContext(profile());
+  ASSERT_TRUE(greaselion_service);
+  extensions::ExtensionRegistry* registry =
+      extensions::ExtensionRegistry::Get(profile());
+
+  auto extension_ids = greaselion_service->GetExtensionIdsForTesting();
+  ASSERT_GT(extension_ids.size(), 0UL);
+  std::vector<const extensions::Extension*> extensions;
+  for (const auto& id : extension_ids)
+    extensions.push_back(registry->enabled_extensions().GetByID(id));
+
+  ASSERT_TRUE(InstallMockExtension());
+  auto reloaded_extension_ids = greaselion_service->GetExtensionIdsForTesting();
+  ASSERT_EQ(extension_ids, reloaded_extension_ids);
+  for (size_t i = 0; i < extension_ids.size(); ++i) {
+    EXPECT_EQ(extensions[i],
+              registry->enabled_extensions().GetByID(extension_ids[i]));
+  }
+}
+
 
 IN_PROC_BROWSER_TEST_F(GreaselionServiceTest,
                       ScriptInjectionWithBrowserVersionConditionLowWild) {
@@ -8,6 +8,7 @@
 #include <memory>
 #include <string>
 #include <utility>
+#include <vector>
 
 #include "base/files/file_util.h"
 #include "base/files/scoped_temp_dir.h"
@@ -55,6 +56,29 @@ class IpfsNetwrokUtilsUnitTest : public testing::Test {
       std::move(callback).Run();
   }
 
+  // File contents must not be copied into the request, only referenced by
+  // file range elements between the generated multipart headers.
+  void ValidateFileRequest(base::OnceClosure callback,
+                           const std::vector<base::FilePath>& expected_files,
+                           std::unique_ptr<network::ResourceRequest> request) {
+    ASSERT_TRUE(request.get());
+    std::vector<base::FilePath> files;
+    const auto& elements = *request->request_body->elements();
+    ASSERT_FALSE(elements.empty());
+    EXPECT_EQ(elements.front().type(),
+              network::mojom::DataElementDataView::Tag::kBytes);
+    EXPECT_EQ(elements.back().type(),
+              network::mojom::DataElementDataView::Tag::kBytes);
+    for (const auto& element : elements) {
+      if (element.type() != network::mojom::DataElementDataView::Tag::kFile)
+        continue;
+      files.push_back(element.As<network::DataElementFile>().path());
+    }
+    EXPECT_EQ(files, expected_files);
+    if (callback)
+      std::move(callback).Run();
+  }
+
  private:
   content::BrowserTaskEnvironment task_environment_;
   TestingProfile profile_;
@@ -103,11 +127,11 @@ TEST_F(IpfsNetwrokUtilsUnitTest, CreateRequestForFileTest) {
   std::string mime_type = "test/type";
   std::string mime_boundary = "mime_boundary";
   base::RunLoop run_loop;
-  auto upload_callback =
-      base::BindOnce(&IpfsNetwrokUtilsUnitTest::ValidateRequest,
-                     base::Unretained(this), run_loop.QuitClosure());
-  CreateRequestForFile(upload_file_path, blob_getter_factory(), mime_type,
-                       filename, std::move(upload_callback), file_size);
+  auto upload_callback = base::BindOnce(
+      &IpfsNetwrokUtilsUnitTest::ValidateFileRequest, base::Unretained(this),
+      run_loop.QuitClosure(), std::vector<base::FilePath>{upload_file_path});
+  CreateRequestForFile(upload_file_path, mime_type, filename,
+                       std::move(upload_callback), file_size);
   run_loop.Run();
 }
 
@@ -130,15 +154,13 @@ TEST_F(IpfsNetwrokUtilsUnitTest, CreateRequestForFolderTest) {
   ASSERT_TRUE(dir.CreateUniqueTempDir());
   std::string content = "test\n\rmultiline\n\rcontent";
   std::string filename = "test_name";
-  CreateCustomTestFile(dir.GetPath(), filename, content);
-  std::string mime_type = "test/type";
-  std::string mime_boundary = "mime_boundary";
+  base::FilePath file_path =
+      CreateCustomTestFile(dir.GetPath(), filename, content);
   base::RunLoop run_loop;
-  auto upload_callback =
-      base::BindOnce(&IpfsNetwrokUtilsUnitTest::ValidateRequest,
-                     base::Unretained(this), run_loop.QuitClosure());
-  CreateRequestForFolder(dir.GetPath(), blob_getter_factory(),
-                         std::move(upload_callback));
+  auto upload_callback = base::BindOnce(
+      &IpfsNetwrokUtilsUnitTest::ValidateFileRequest, base::Unretained(this),
+      run_loop.QuitClosure(), std::vector<base::FilePath>{file_path});
+  CreateRequestForFolder(dir.GetPath(), std::move(upload_callback));
   run_loop.Run();
 }
 
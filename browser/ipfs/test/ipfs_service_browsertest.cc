@@ -4,11 +4,13 @@
  * You can obtain one at http://mozilla.org/MPL/2.0/. */
 
 #include "base/base64.h"
+#include "base/files/file_util.h"
 #include "base/memory/raw_ptr.h"
 #include "base/path_service.h"
 #include "base/run_loop.h"
 #include "base/strings/strcat.h"
 #include "base/strings/stringprintf.h"
+#include "base/test/bind.h"
 #include "base/test/mock_callback.h"
 #include "base/test/scoped_feature_list.h"
 #include "brave/browser/brave_browser_process.h"
@@ -19,6 +21,7 @@
 #include "brave/components/ipfs/brave_ipfs_client_updater.h"
 #include "brave/components/ipfs/features.h"
 #include "brave/components/ipfs/import/imported_data.h"
+#include "brave/components/ipfs/import/ipfs_import_worker_base.h"
 #include "brave/components/ipfs/ipfs_constants.h"
 #include "brave/components/ipfs/ipfs_service.h"
 #include "brave/components/ipfs/ipfs_utils.h"
@@ -29,6 +32,7 @@
 #include "chrome/test/base/in_process_browser_test.h"
 #include "chrome/test/base/ui_test_utils.h"
 #include "components/prefs/pref_service.h"
+#include "content/public/browser/storage_partition.h"
 #include "content/public/test/browser_test.h"
 #include "content/public/test/content_mock_cert_verifier.h"
 #include "net/base/registry_controlled_domains/registry_controlled_domain.h"
@@ -36,6 +40,8 @@
 #include "net/test/embedded_test_server/http_request.h"
 #include "net/test/embedded_test_server/http_response.h"
 #include "net/test/url_request/url_request_failed_job.h"
+#include "services/network/public/cpp/shared_url_loader_factory.h"
+#include "services/network/test/test_url_loader_factory.h"
 
 namespace {
 const char kTestLinkImportPath[] = "/link.png";
@@ -272,6 +278,15 @@ class IpfsServiceBrowserTest : public InProcessBrowserTest {
     return HandleImportRequests(expected_result, request);
   }
 
+  std::unique_ptr<net::test_server::HttpResponse>
+  HandleImportRequestsAndRecordUpload(
+      const std::string& expected_response,
+      const net::test_server::HttpRequest& request) {
+    if (request.GetURL().path_piece() == kImportAddPath)
+      uploaded_content_ = request.content;
+    return HandleImportRequests(expected_response, request);
+  }
+
   std::unique_ptr<net::test_server::HttpResponse> HandleImportRequests(
       const std::string& expected_response,
       const net::test_server::HttpRequest& request) {
@@ -638,11 +653,14 @@ class IpfsServiceBrowserTest : public InProcessBrowserTest {
 
   FakeIpfsService* fake_ipfs_service() { return fake_service_.get(); }
 
+  const std::string& uploaded_content() const { return uploaded_content_; }
+
  private:
   content::ContentMockCertVerifier mock_cert_verifier_;
   std::unique_ptr<FakeIpfsService> fake_service_;
   std::unique_ptr<base::RunLoop> wait_for_request_;
   std::unique_ptr<net::EmbeddedTestServer> test_server_;
+  std::string uploaded_content_;
   raw_ptr<IpfsService> ipfs_service_ = nullptr;
   base::test::ScopedFeatureList feature_list_;
 };
@@ -1126,6 +1144,68 @@ IN_PROC_BROWSER_TEST_F(IpfsServiceBrowserTest, ImportFileToIpfsSuccess) {
   WaitForRequest();
 }
 
+IN_PROC_BROWSER_TEST_F(IpfsServiceBrowserTest, ImportFileStreamsUpload) {
+  std::string expected_response =
+      R"({"Name":"adbanner.js", "Size":"567857", "Hash": "QmYbK4SLa"})";
+  ResetTestServer(base::BindRepeating(
+      &IpfsServiceBrowserTest::HandleImportRequestsAndRecordUpload,
+      base::Unretained(this), expected_response));
+  auto file_to_upload = embedded_test_server()->GetFullPathFromSourceDirectory(
+      base::FilePath(FILE_PATH_LITERAL("brave/test/data/adbanner.js")));
+  std::string file_contents;
+  {
+    base::ScopedAllowBlockingForTesting allow_blocking;
+    ASSERT_TRUE(base::ReadFileToString(file_to_upload, &file_contents));
+  }
+
+  auto url_loader_factory = browser()
+                                ->profile()
+                                ->GetDefaultStoragePartition()
+                                ->GetURLLoaderFactoryForBrowserProcess();
+  base::RunLoop run_loop;
+  IpfsImportWorkerBase worker(
+      nullptr, url_loader_factory.get(), GetURL("127.0.0.1", "/"),
+      base::BindLambdaForTesting([&](const ipfs::ImportedData& data) {
+        EXPECT_EQ(data.state, ipfs::IPFS_IMPORT_SUCCESS);
+        run_loop.Quit();
+      }));
+  worker.ImportFile(file_to_upload);
+  run_loop.Run();
+
+  // The file went out unchanged, wrapped in the multipart body.
+  EXPECT_GT(uploaded_content().size(), file_contents.size());
+  EXPECT_NE(uploaded_content().find(file_contents), std::string::npos);
+}
+
+IN_PROC_BROWSER_TEST_F(IpfsServiceBrowserTest, ImportFileCancelledMidUpload) {
+  network::TestURLLoaderFactory url_loader_factory;
+  base::RunLoop request_started;
+  url_loader_factory.SetInterceptor(base::BindLambdaForTesting(
+      [&](const network::ResourceRequest& request) {
+        request_started.Quit();
+      }));
+  auto file_to_upload = embedded_test_server()->GetFullPathFromSourceDirectory(
+      base::FilePath(FILE_PATH_LITERAL("brave/test/data/adbanner.js")));
+
+  auto worker = std::make_unique<IpfsImportWorkerBase>(
+      nullptr, &url_loader_factory, GetURL("127.0.0.1", "/"),
+      base::BindLambdaForTesting([&](const ipfs::ImportedData& data) {
+        ADD_FAILURE() << "Cancelled import completed with " << data.state;
+      }));
+  worker->ImportFile(file_to_upload);
+  request_started.Run();
+
+  // The upload has started but no response came yet. Deleting the worker
+  // drops the loader, which cancels the request.
+  ASSERT_EQ(url_loader_factory.NumPending(), 1);
+  auto* pending_request = url_loader_factory.GetPendingRequest(0);
+  ASSERT_TRUE(pending_request->request.request_body);
+  EXPECT_TRUE(pending_request->client.is_connected());
+  worker.reset();
+  pending_request->client.FlushForTesting();
+  EXPECT_FALSE(pending_request->client.is_connected());
+}
+
 IN_PROC_BROWSER_TEST_F(IpfsServiceBrowserTest, ImportDirectoryToIpfsSuccess) {
   std::string expected_response =
       R"({"Name":"autoplay-whitelist-data", "Size":"567857", "Hash": "QmYbK4SLa"})";
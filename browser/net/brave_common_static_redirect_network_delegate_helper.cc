@@ -92,5 +92,12 @@ int OnBeforeURLRequest_CommonStaticRedirectWorkForGURL(
   return net::OK;
 }
 
+bool IsCommonStaticRedirectCandidate(const GURL& url) {
+  // Hosts of the patterns in OnBeforeURLRequest_CommonStaticRedirectWorkForGURL
+  return url.SchemeIsHTTPOrHTTPS() &&
+         (url.DomainIs("gvt1.com") ||
+          url.host_piece() == "clients4.google.com" ||
+          url.host_piece() == "bugs.chromium.org");
+}
 
 }  // namespace brave
@@ -22,6 +22,9 @@ int OnBeforeURLRequest_CommonStaticRedirectWorkForGURL(
     const GURL& url,
     GURL* new_url);
 
+// Whether |url| is on a host that the work above can redirect.
+bool IsCommonStaticRedirectCandidate(const GURL& url);
+
 }  // namespace brave
 
 #endif  // BRAVE_BROWSER_NET_BRAVE_COMMON_STATIC_REDIRECT_NETWORK_DELEGATE_HELPER_H_
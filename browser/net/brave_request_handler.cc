@@ -10,6 +10,7 @@
 
 #include "base/containers/contains.h"
 #include "base/feature_list.h"
+#include "base/metrics/histogram.h"
 #include "base/task/post_task.h"
 #include "brave/browser/net/brave_ad_block_csp_network_delegate_helper.h"
 #include "brave/browser/net/brave_ad_block_tp_network_delegate_helper.h"
@@ -44,10 +45,13 @@
 #if BUILDFLAG(ENABLE_IPFS)
 #include "brave/browser/net/ipfs_redirect_network_delegate_helper.h"
 #include "brave/components/ipfs/features.h"
+#include "brave/components/ipfs/ipfs_constants.h"
 #endif
 
 #if BUILDFLAG(DECENTRALIZED_DNS_ENABLED)
 #include "brave/browser/net/decentralized_dns_network_delegate_helper.h"
+#include "brave/components/decentralized_dns/utils.h"
+#include "content/public/browser/browser_context.h"
 #endif
 
 static bool IsInternalScheme(std::shared_ptr<brave::BraveRequestInfo> ctx) {
@@ -67,33 +71,41 @@ BraveRequestHandler::BraveRequestHandler() {
 BraveRequestHandler::~BraveRequestHandler() = default;
 
 void BraveRequestHandler::SetupCallbacks() {
-  brave::OnBeforeURLRequestCallback callback =
-      base::BindRepeating(brave::OnBeforeURLRequest_SiteHacksWork);
-  before_url_request_callbacks_.push_back(callback);
+  AddBeforeURLRequestCallback(
+      kSiteHacks, "Brave.RequestHandler.OnBeforeURLRequest.SiteHacks",
+      base::BindRepeating(brave::OnBeforeURLRequest_SiteHacksWork));
 
-  callback = base::BindRepeating(brave::OnBeforeURLRequest_AdBlockTPPreWork);
-  before_url_request_callbacks_.push_back(callback);
+  AddBeforeURLRequestCallback(
+      kAdBlockTP, "Brave.RequestHandler.OnBeforeURLRequest.AdBlockTP",
+      base::BindRepeating(brave::OnBeforeURLRequest_AdBlockTPPreWork));
 
-  callback = base::BindRepeating(brave::OnBeforeURLRequest_HttpsePreFileWork);
-  before_url_request_callbacks_.push_back(callback);
+  AddBeforeURLRequestCallback(
+      kHttpse, "Brave.RequestHandler.OnBeforeURLRequest.Httpse",
+      base::BindRepeating(brave::OnBeforeURLRequest_HttpsePreFileWork));
 
-  callback =
-      base::BindRepeating(brave::OnBeforeURLRequest_CommonStaticRedirectWork);
-  before_url_request_callbacks_.push_back(callback);
+  AddBeforeURLRequestCallback(
+      kCommonStaticRedirect,
+      "Brave.RequestHandler.OnBeforeURLRequest.CommonStaticRedirect",
+      base::BindRepeating(brave::OnBeforeURLRequest_CommonStaticRedirectWork));
 
 #if BUILDFLAG(DECENTRALIZED_DNS_ENABLED)
-  callback = base::BindRepeating(
-      decentralized_dns::OnBeforeURLRequest_DecentralizedDnsPreRedirectWork);
-  before_url_request_callbacks_.push_back(callback);
+  AddBeforeURLRequestCallback(
+      kDecentralizedDns,
+      "Brave.RequestHandler.OnBeforeURLRequest.DecentralizedDns",
+      base::BindRepeating(
+          decentralized_dns::
+              OnBeforeURLRequest_DecentralizedDnsPreRedirectWork));
 #endif
 
-  callback = base::BindRepeating(brave_rewards::OnBeforeURLRequest);
-  before_url_request_callbacks_.push_back(callback);
+  AddBeforeURLRequestCallback(
+      kRewards, "Brave.RequestHandler.OnBeforeURLRequest.Rewards",
+      base::BindRepeating(brave_rewards::OnBeforeURLRequest));
 
 #if BUILDFLAG(ENABLE_IPFS)
   if (base::FeatureList::IsEnabled(ipfs::features::kIpfsFeature)) {
-    callback = base::BindRepeating(ipfs::OnBeforeURLRequest_IPFSRedirectWork);
-    before_url_request_callbacks_.push_back(callback);
+    AddBeforeURLRequestCallback(
+        kIpfsRedirect, "Brave.RequestHandler.OnBeforeURLRequest.IpfsRedirect",
+        base::BindRepeating(ipfs::OnBeforeURLRequest_IPFSRedirectWork));
     brave::OnHeadersReceivedCallback ipfs_headers_received_callback =
         base::BindRepeating(ipfs::OnHeadersReceived_IPFSRedirectWork);
     headers_received_callbacks_.push_back(ipfs_headers_received_callback);
@@ -132,6 +144,69 @@ void BraveRequestHandler::SetupCallbacks() {
   }
 }
 
+void BraveRequestHandler::AddBeforeURLRequestCallback(
+    BeforeURLRequestHelper helper,
+    const char* histogram_name,
+    brave::OnBeforeURLRequestCallback callback) {
+  // Same histogram as base::UmaHistogramTimes(), looked up once instead of
+  // for every request.
+  base::HistogramBase* histogram = base::Histogram::FactoryTimeGet(
+      histogram_name, base::Milliseconds(1), base::Seconds(10), 50,
+      base::HistogramBase::kUmaTargetedHistogramFlag);
+  before_url_request_callbacks_.push_back(
+      {helper, histogram, std::move(callback)});
+  before_url_request_helpers_ |= helper;
+}
+
+// static
+uint32_t BraveRequestHandler::GetBeforeURLRequestHelpers(
+    const brave::BraveRequestInfo& ctx) {
+  const GURL& url = ctx.request_url;
+  const bool is_http = url.SchemeIsHTTPOrHTTPS();
+  uint32_t helpers = 0;
+
+  // Both the referrer cap and the query string filter are shields features.
+  if (ctx.allow_brave_shields &&
+      (url.has_query() || (!ctx.allow_referrers && !ctx.referrer.is_empty()))) {
+    helpers |= kSiteHacks;
+  }
+
+  // Main frames are left to DomainBlockNavigationThrottle.
+  if (ctx.allow_brave_shields && !ctx.allow_ads &&
+      (is_http || url.SchemeIsWSOrWSS()) && ctx.initiator_url.has_host() &&
+      ctx.resource_type != brave::BraveRequestInfo::kInvalidResourceType &&
+      ctx.resource_type != blink::mojom::ResourceType::kMainFrame) {
+    helpers |= kAdBlockTP;
+  }
+
+  if (ctx.allow_brave_shields && !ctx.allow_http_upgradable_resource &&
+      !ctx.tab_origin.is_empty() && is_http) {
+    helpers |= kHttpse;
+  }
+
+  if (brave::IsCommonStaticRedirectCandidate(url))
+    helpers |= kCommonStaticRedirect;
+
+#if BUILDFLAG(DECENTRALIZED_DNS_ENABLED)
+  if (ctx.browser_context && !ctx.browser_context->IsOffTheRecord() &&
+      (decentralized_dns::IsUnstoppableDomainsTLD(url) ||
+       decentralized_dns::IsENSTLD(url))) {
+    helpers |= kDecentralizedDns;
+  }
+#endif
+
+  // Media publishers are only reported from requests that carry a body.
+  if (!ctx.upload_data.empty())
+    helpers |= kRewards;
+
+#if BUILDFLAG(ENABLE_IPFS)
+  if (url.SchemeIs(ipfs::kIPFSScheme) || url.SchemeIs(ipfs::kIPNSScheme))
+    helpers |= kIpfsRedirect;
+#endif
+
+  return helpers;
+}
+
 bool BraveRequestHandler::IsRequestIdentifierValid(
     uint64_t request_identifier) {
   return base::Contains(callbacks_, request_identifier);
@@ -144,6 +219,12 @@ int BraveRequestHandler::OnBeforeURLRequest(
   if (before_url_request_callbacks_.empty() || IsInternalScheme(ctx)) {
     return net::OK;
   }
+  ctx->before_url_request_helpers =
+      GetBeforeURLRequestHelpers(*ctx) & before_url_request_helpers_;
+  if (!ctx->before_url_request_helpers) {
+    // Nothing can change the request, so don't go async for it.
+    return net::OK;
+  }
   ctx->new_url = new_url;
   ctx->event_type = brave::kOnBeforeRequest;
   callbacks_[ctx->request_identifier] = std::move(callback);
@@ -211,6 +292,14 @@ void BraveRequestHandler::RunCallbackForRequestIdentifier(
                  base::BindOnce(std::move(it->second), rv));
 }
 
+void BraveRequestHandler::OnBeforeURLRequestHelperDone(
+    base::HistogramBase* histogram,
+    base::TimeTicks start_time,
+    std::shared_ptr<brave::BraveRequestInfo> ctx) {
+  histogram->AddTime(base::TimeTicks::Now() - start_time);
+  RunNextCallback(ctx);
+}
+
 // TODO(iefremov): Merge all callback containers into one and run only one loop
 // instead of many (issues/5574).
 void BraveRequestHandler::RunNextCallback(
@@ -227,15 +316,20 @@ void BraveRequestHandler::RunNextCallback(
   if (ctx->event_type == brave::kOnBeforeRequest) {
     while (before_url_request_callbacks_.size() !=
            ctx->next_url_request_index) {
-      brave::OnBeforeURLRequestCallback callback =
+      const BeforeURLRequestEntry& entry =
           before_url_request_callbacks_[ctx->next_url_request_index++];
-      brave::ResponseCallback next_callback =
-          base::BindRepeating(&BraveRequestHandler::RunNextCallback,
-                              weak_factory_.GetWeakPtr(), ctx);
-      rv = callback.Run(next_callback, ctx);
+      if (!(ctx->before_url_request_helpers & entry.helper)) {
+        continue;
+      }
+      const base::TimeTicks start_time = base::TimeTicks::Now();
+      brave::ResponseCallback next_callback = base::BindRepeating(
+          &BraveRequestHandler::OnBeforeURLRequestHelperDone,
+          weak_factory_.GetWeakPtr(), entry.histogram, start_time, ctx);
+      rv = entry.callback.Run(next_callback, ctx);
       if (rv == net::ERR_IO_PENDING) {
         return;
       }
+      entry.histogram->AddTime(base::TimeTicks::Now() - start_time);
       if (rv != net::OK) {
         break;
       }
@@ -6,21 +6,39 @@
 #ifndef BRAVE_BROWSER_NET_BRAVE_REQUEST_HANDLER_H_
 #define BRAVE_BROWSER_NET_BRAVE_REQUEST_HANDLER_H_
 
+#include <stdint.h>
+
 #include <map>
 #include <memory>
 #include <string>
 #include <vector>
 
+#include "base/time/time.h"
 #include "brave/browser/net/url_context.h"
 #include "content/public/browser/browser_thread.h"
 #include "net/base/completion_once_callback.h"
 
 class PrefChangeRegistrar;
 
+namespace base {
+class HistogramBase;
+}  // namespace base
+
 // Contains different network stack hooks (similar to capabilities of WebRequest
 // API).
 class BraveRequestHandler {
  public:
+  // OnBeforeURLRequest helpers, as bits of a per-request mask.
+  enum BeforeURLRequestHelper : uint32_t {
+    kSiteHacks = 1 << 0,
+    kAdBlockTP = 1 << 1,
+    kHttpse = 1 << 2,
+    kCommonStaticRedirect = 1 << 3,
+    kDecentralizedDns = 1 << 4,
+    kRewards = 1 << 5,
+    kIpfsRedirect = 1 << 6,
+  };
+
   BraveRequestHandler();
   BraveRequestHandler(const BraveRequestHandler&) = delete;
   BraveRequestHandler& operator=(const BraveRequestHandler&) = delete;
@@ -45,11 +63,33 @@ class BraveRequestHandler {
   void OnURLRequestDestroyed(std::shared_ptr<brave::BraveRequestInfo> ctx);
   void RunCallbackForRequestIdentifier(uint64_t request_identifier, int rv);
 
+  // Returns the mask of helpers that can possibly act on |ctx|, looking only
+  // at its scheme, host, resource type and shields state. Helpers outside of
+  // the mask are not run for the request.
+  static uint32_t GetBeforeURLRequestHelpers(
+      const brave::BraveRequestInfo& ctx);
+
  private:
+  struct BeforeURLRequestEntry {
+    BeforeURLRequestHelper helper;
+    // Records how long the helper took, including any asynchronous work.
+    base::HistogramBase* histogram;
+    brave::OnBeforeURLRequestCallback callback;
+  };
+
   void SetupCallbacks();
+  void AddBeforeURLRequestCallback(BeforeURLRequestHelper helper,
+                                   const char* histogram_name,
+                                   brave::OnBeforeURLRequestCallback callback);
   void RunNextCallback(std::shared_ptr<brave::BraveRequestInfo> ctx);
+  void OnBeforeURLRequestHelperDone(
+      base::HistogramBase* histogram,
+      base::TimeTicks start_time,
+      std::shared_ptr<brave::BraveRequestInfo> ctx);
 
-  std::vector<brave::OnBeforeURLRequestCallback> before_url_request_callbacks_;
+  std::vector<BeforeURLRequestEntry> before_url_request_callbacks_;
+  // Union of the helpers in |before_url_request_callbacks_|.
+  uint32_t before_url_request_helpers_ = 0;
   std::vector<brave::OnBeforeStartTransactionCallback>
       before_start_transaction_callbacks_;
   std::vector<brave::OnHeadersReceivedCallback> headers_received_callbacks_;
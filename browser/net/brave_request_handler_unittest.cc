@@ -0,0 +1,136 @@
+/* Copyright (c) 2022 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "brave/browser/net/brave_request_handler.h"
+
+#include <memory>
+#include <utility>
+
+#include "base/bind.h"
+#include "brave/browser/net/url_context.h"
+#include "brave/components/ipfs/buildflags/buildflags.h"
+#include "content/public/test/browser_task_environment.h"
+#include "net/base/net_errors.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace {
+
+std::unique_ptr<brave::BraveRequestInfo> MakeSubresourceRequest(
+    const GURL& url) {
+  auto ctx = std::make_unique<brave::BraveRequestInfo>(url);
+  ctx->initiator_url = GURL("https://example.com/");
+  ctx->tab_origin = GURL("https://example.com/");
+  ctx->resource_type = blink::mojom::ResourceType::kScript;
+  return ctx;
+}
+
+}  // namespace
+
+TEST(BraveRequestHandlerTest, ShieldsUpSubresourceRunsShieldsHelpers) {
+  auto ctx = MakeSubresourceRequest(GURL("https://tracker.com/a.js"));
+  const uint32_t helpers =
+      BraveRequestHandler::GetBeforeURLRequestHelpers(*ctx);
+  EXPECT_TRUE(helpers & BraveRequestHandler::kAdBlockTP);
+  EXPECT_TRUE(helpers & BraveRequestHandler::kHttpse);
+  EXPECT_FALSE(helpers & BraveRequestHandler::kCommonStaticRedirect);
+  EXPECT_FALSE(helpers & BraveRequestHandler::kSiteHacks);
+  EXPECT_FALSE(helpers & BraveRequestHandler::kRewards);
+  EXPECT_FALSE(helpers & BraveRequestHandler::kIpfsRedirect);
+
+  ctx->request_url = GURL("https://tracker.com/a.js?fbclid=1");
+  EXPECT_TRUE(BraveRequestHandler::GetBeforeURLRequestHelpers(*ctx) &
+              BraveRequestHandler::kSiteHacks);
+
+  ctx->request_url = GURL("https://tracker.com/a.js");
+  ctx->referrer = GURL("https://example.com/page");
+  EXPECT_TRUE(BraveRequestHandler::GetBeforeURLRequestHelpers(*ctx) &
+              BraveRequestHandler::kSiteHacks);
+}
+
+TEST(BraveRequestHandlerTest, ShieldsDownSkipsShieldsHelpers) {
+  auto ctx = MakeSubresourceRequest(GURL("https://tracker.com/a.js?fbclid=1"));
+  ctx->referrer = GURL("https://example.com/page");
+  ctx->allow_brave_shields = false;
+  EXPECT_EQ(BraveRequestHandler::GetBeforeURLRequestHelpers(*ctx), 0u);
+}
+
+TEST(BraveRequestHandlerTest, NoHelpersStaysSynchronous) {
+  content::BrowserTaskEnvironment task_environment;
+  BraveRequestHandler handler;
+  auto ctx = MakeSubresourceRequest(GURL("https://tracker.com/a.js"));
+  ctx->allow_brave_shields = false;
+  GURL new_url;
+  EXPECT_EQ(handler.OnBeforeURLRequest(
+                std::move(ctx),
+                base::BindOnce([](int rv) { ADD_FAILURE() << rv; }), &new_url),
+            net::OK);
+  task_environment.RunUntilIdle();
+  EXPECT_TRUE(new_url.is_empty());
+}
+
+TEST(BraveRequestHandlerTest, StaticRedirectHostsRunCommonStaticRedirect) {
+  auto ctx = MakeSubresourceRequest(GURL(
+      "https://r1---sn-abc.gvt1.com/edgedl/chromewebstore/"
+      "pkedcjkdefgpdelpbcmbmeomcjbeemfm.crx"));
+  ctx->allow_brave_shields = false;
+  EXPECT_EQ(BraveRequestHandler::GetBeforeURLRequestHelpers(*ctx),
+            static_cast<uint32_t>(BraveRequestHandler::kCommonStaticRedirect));
+
+  ctx->request_url = GURL("https://clients4.google.com/chrome-sync/dev");
+  EXPECT_EQ(BraveRequestHandler::GetBeforeURLRequestHelpers(*ctx),
+            static_cast<uint32_t>(BraveRequestHandler::kCommonStaticRedirect));
+
+  ctx->request_url = GURL("https://bugs.chromium.org/p/chromium/issues/entry");
+  EXPECT_EQ(BraveRequestHandler::GetBeforeURLRequestHelpers(*ctx),
+            static_cast<uint32_t>(BraveRequestHandler::kCommonStaticRedirect));
+
+  ctx->request_url = GURL("https://google.com/");
+  EXPECT_EQ(BraveRequestHandler::GetBeforeURLRequestHelpers(*ctx), 0u);
+}
+
+TEST(BraveRequestHandlerTest, AdBlockSkipsMainFramesAndAllowedAds) {
+  auto ctx = MakeSubresourceRequest(GURL("https://tracker.com/"));
+  ctx->resource_type = blink::mojom::ResourceType::kMainFrame;
+  EXPECT_FALSE(BraveRequestHandler::GetBeforeURLRequestHelpers(*ctx) &
+               BraveRequestHandler::kAdBlockTP);
+
+  ctx->resource_type = blink::mojom::ResourceType::kImage;
+  ctx->allow_ads = true;
+  EXPECT_FALSE(BraveRequestHandler::GetBeforeURLRequestHelpers(*ctx) &
+               BraveRequestHandler::kAdBlockTP);
+
+  ctx->allow_ads = false;
+  ctx->request_url = GURL("wss://tracker.com/socket");
+  EXPECT_TRUE(BraveRequestHandler::GetBeforeURLRequestHelpers(*ctx) &
+              BraveRequestHandler::kAdBlockTP);
+}
+
+TEST(BraveRequestHandlerTest, NonNetworkSchemesHaveNoHelpers) {
+  auto ctx = MakeSubresourceRequest(GURL("data:text/plain,hello"));
+  EXPECT_EQ(BraveRequestHandler::GetBeforeURLRequestHelpers(*ctx), 0u);
+
+  ctx->request_url = GURL("blob:https://example.com/uuid");
+  EXPECT_EQ(BraveRequestHandler::GetBeforeURLRequestHelpers(*ctx), 0u);
+}
+
+TEST(BraveRequestHandlerTest, UploadsRunRewards) {
+  auto ctx = MakeSubresourceRequest(GURL("https://media.example.com/track"));
+  ctx->upload_data = "payload";
+  EXPECT_TRUE(BraveRequestHandler::GetBeforeURLRequestHelpers(*ctx) &
+              BraveRequestHandler::kRewards);
+}
+
+#if BUILDFLAG(ENABLE_IPFS)
+TEST(BraveRequestHandlerTest, IpfsSchemesRunIpfsRedirect) {
+  auto ctx = MakeSubresourceRequest(GURL(
+      "ipfs://bafybeiemxf5abjwjbikoz4mc3a3dla6ual3jsgpdr4cjr3oz3evfyavhwq"));
+  EXPECT_EQ(BraveRequestHandler::GetBeforeURLRequestHelpers(*ctx),
+            static_cast<uint32_t>(BraveRequestHandler::kIpfsRedirect));
+
+  ctx->request_url = GURL("ipns://brave.eth");
+  EXPECT_EQ(BraveRequestHandler::GetBeforeURLRequestHelpers(*ctx),
+            static_cast<uint32_t>(BraveRequestHandler::kIpfsRedirect));
+}
+#endif  // BUILDFLAG(ENABLE_IPFS)
@@ -9,9 +9,12 @@
 #include <vector>
 
 #include "brave/browser/brave_wallet/json_rpc_service_factory.h"
+#include "brave/browser/decentralized_dns/decentralized_dns_service_factory.h"
 #include "brave/components/brave_wallet/browser/json_rpc_service.h"
 #include "brave/components/brave_wallet/common/brave_wallet.mojom.h"
 #include "brave/components/decentralized_dns/constants.h"
+#include "brave/components/decentralized_dns/decentralized_dns_service.h"
+#include "brave/components/decentralized_dns/resolution_cache.h"
 #include "brave/components/decentralized_dns/utils.h"
 #include "brave/components/ipfs/ipfs_utils.h"
 #include "chrome/browser/browser_process.h"
@@ -26,6 +29,64 @@ std::string GetValue(const std::vector<std::string>& arr, RecordKeys key) {
   return arr[static_cast<size_t>(key)];
 }
 
+brave_wallet::mojom::ProviderError ToProviderError(bool success) {
+  return success ? brave_wallet::mojom::ProviderError::kSuccess
+                 : brave_wallet::mojom::ProviderError::kInternalError;
+}
+
+void OnUnstoppableDomainsProxyReaderGetMany(
+    ResolutionCache::ResolveCallback callback,
+    const std::vector<std::string>& values,
+    brave_wallet::mojom::ProviderError error,
+    const std::string& error_message) {
+  std::move(callback).Run(error == brave_wallet::mojom::ProviderError::kSuccess,
+                          values);
+}
+
+void ResolveUnstoppableDomains(brave_wallet::JsonRpcService* json_rpc_service,
+                               const std::string& domain,
+                               ResolutionCache::ResolveCallback callback) {
+  auto keys = std::vector<std::string>(std::begin(kRecordKeys),
+                                       std::end(kRecordKeys));
+  json_rpc_service->UnstoppableDomainsProxyReaderGetMany(
+      brave_wallet::mojom::kMainnetChainId, domain, keys,
+      base::BindOnce(&OnUnstoppableDomainsProxyReaderGetMany,
+                     std::move(callback)));
+}
+
+void OnUnstoppableDomainsResolved(const brave::ResponseCallback& next_callback,
+                                  std::shared_ptr<brave::BraveRequestInfo> ctx,
+                                  bool success,
+                                  const ResolutionCache::Records& records) {
+  OnBeforeURLRequest_UnstoppableDomainsRedirectWork(
+      next_callback, ctx, records, ToProviderError(success), std::string());
+}
+
+void OnEnsResolverGetContentHash(ResolutionCache::ResolveCallback callback,
+                                 const std::string& content_hash,
+                                 brave_wallet::mojom::ProviderError error,
+                                 const std::string& error_message) {
+  std::move(callback).Run(error == brave_wallet::mojom::ProviderError::kSuccess,
+                          {content_hash});
+}
+
+void ResolveEns(brave_wallet::JsonRpcService* json_rpc_service,
+                const std::string& domain,
+                ResolutionCache::ResolveCallback callback) {
+  json_rpc_service->EnsResolverGetContentHash(
+      brave_wallet::mojom::kMainnetChainId, domain,
+      base::BindOnce(&OnEnsResolverGetContentHash, std::move(callback)));
+}
+
+void OnEnsResolved(const brave::ResponseCallback& next_callback,
+                   std::shared_ptr<brave::BraveRequestInfo> ctx,
+                   bool success,
+                   const ResolutionCache::Records& records) {
+  OnBeforeURLRequest_EnsRedirectWork(
+      next_callback, ctx, records.empty() ? std::string() : records.front(),
+      ToProviderError(success), std::string());
+}
+
 }  // namespace
 
 int OnBeforeURLRequest_DecentralizedDnsPreRedirectWork(
@@ -42,25 +103,47 @@ int OnBeforeURLRequest_DecentralizedDnsPreRedirectWork(
   if (!json_rpc_service)
     return net::OK;
 
+  auto* decentralized_dns_service =
+      DecentralizedDnsServiceFactory::GetForContext(ctx->browser_context);
+  if (!decentralized_dns_service)
+    return net::OK;
+
+  // Every subresource of a dweb page hits this path, so results are cached
+  // per host and concurrent lookups are coalesced.
+  ResolutionCache* cache = decentralized_dns_service->resolution_cache();
+  const std::string host = ctx->request_url.host();
+  bool success = false;
+  ResolutionCache::Records records;
+
   if (IsUnstoppableDomainsTLD(ctx->request_url) &&
       IsUnstoppableDomainsResolveMethodEthereum(
           g_browser_process->local_state())) {
-    auto keys = std::vector<std::string>(std::begin(kRecordKeys),
-                                         std::end(kRecordKeys));
-    json_rpc_service->UnstoppableDomainsProxyReaderGetMany(
-        brave_wallet::mojom::kMainnetChainId, ctx->request_url.host(), keys,
-        base::BindOnce(&OnBeforeURLRequest_UnstoppableDomainsRedirectWork,
-                       next_callback, ctx));
+    if (cache->GetCached(host, &success, &records)) {
+      OnUnstoppableDomainsResolved(brave::ResponseCallback(), ctx, success,
+                                   records);
+      return net::OK;
+    }
+
+    cache->Resolve(host,
+                   base::BindOnce(&ResolveUnstoppableDomains,
+                                  base::Unretained(json_rpc_service), host),
+                   base::BindOnce(&OnUnstoppableDomainsResolved,
+                                  next_callback, ctx));
 
     return net::ERR_IO_PENDING;
   }
 
   if (IsENSTLD(ctx->request_url) &&
       IsENSResolveMethodEthereum(g_browser_process->local_state())) {
-    json_rpc_service->EnsResolverGetContentHash(
-        brave_wallet::mojom::kMainnetChainId, ctx->request_url.host(),
-        base::BindOnce(&OnBeforeURLRequest_EnsRedirectWork, next_callback,
-                       ctx));
+    if (cache->GetCached(host, &success, &records)) {
+      OnEnsResolved(brave::ResponseCallback(), ctx, success, records);
+      return net::OK;
+    }
+
+    cache->Resolve(host,
+                   base::BindOnce(&ResolveEns,
+                                  base::Unretained(json_rpc_service), host),
+                   base::BindOnce(&OnEnsResolved, next_callback, ctx));
 
     return net::ERR_IO_PENDING;
   }
@@ -87,6 +87,8 @@ struct BraveRequestInfo {
   int frame_tree_node_id = 0;
   uint64_t request_identifier = 0;
   size_t next_url_request_index = 0;
+  // Mask of BraveRequestHandler::BeforeURLRequestHelper to run.
+  uint32_t before_url_request_helpers = 0;
 
   content::BrowserContext* browser_context = nullptr;
   net::HttpRequestHeaders* headers = nullptr;
@@ -321,7 +321,19 @@ void BraveShieldsDataController::SetIsHTTPSEverywhereEnabled(bool is_enabled) {
   ReloadWebContents();
 }
 
-void BraveShieldsDataController::HandleItemBlocked(
+void BraveShieldsDataController::HandleItemsBlocked(
+    const std::vector<std::pair<std::string, std::string>>& items) {
+  if (items.empty())
+    return;
+
+  for (const auto& item : items)
+    AddBlockedItem(item.first, item.second);
+
+  for (Observer& obs : observer_list_)
+    obs.OnResourcesChanged();
+}
+
+void BraveShieldsDataController::AddBlockedItem(
     const std::string& block_type,
     const std::string& subresource) {
   auto subres = GURL(subresource);
@@ -335,9 +347,6 @@ void BraveShieldsDataController::HandleItemBlocked(
   } else if (block_type == kFingerprintingV2) {
     resource_list_blocked_fingerprints_.insert(subres);
   }
-
-  for (Observer& obs : observer_list_)
-    obs.OnResourcesChanged();
 }
 
 WEB_CONTENTS_USER_DATA_KEY_IMPL(BraveShieldsDataController);
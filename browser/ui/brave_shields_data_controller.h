@@ -8,6 +8,7 @@
 
 #include <set>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "base/observer_list.h"
@@ -42,8 +43,10 @@ class BraveShieldsDataController
     virtual void OnFaviconUpdated() {}
   };
 
-  void HandleItemBlocked(const std::string& block_type,
-                         const std::string& subresource);
+  // Records a batch of (block type, subresource) pairs and notifies observers
+  // once for the whole batch.
+  void HandleItemsBlocked(
+      const std::vector<std::pair<std::string, std::string>>& items);
   void ClearAllResourcesList();
   int GetTotalBlockedCount();
   std::vector<GURL> GetBlockedAdsList();
@@ -88,6 +91,8 @@ class BraveShieldsDataController
                         const gfx::Image& image) override;
 
   void ReloadWebContents();
+  void AddBlockedItem(const std::string& block_type,
+                      const std::string& subresource);
 
   base::ObserverList<Observer> observer_list_;
   std::set<GURL> resource_list_blocked_ads_;
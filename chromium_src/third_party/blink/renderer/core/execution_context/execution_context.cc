@@ -5,7 +5,10 @@
 
 #include "third_party/blink/renderer/core/execution_context/execution_context.h"
 
+#include "base/bind.h"
 #include "base/command_line.h"
+#include "base/containers/span.h"
+#include "base/hash/hash.h"
 #include "base/sequence_checker.h"
 #include "base/strings/string_number_conversions.h"
 #include "brave/third_party/blink/renderer/brave_farbling_constants.h"
@@ -43,18 +46,24 @@ float ConstantMultiplier(double fudge_factor, float value, size_t index) {
   return value * fudge_factor;
 }
 
-float PseudoRandomSequence(uint64_t seed, float value, size_t index) {
-  static uint64_t v;
+// Maps the next LFSR state to a pseudo-random float between 0 and 0.1
+inline float PseudoRandomSample(uint64_t v) {
   const double maxUInt64AsDouble = UINT64_MAX;
+  return (v / maxUInt64AsDouble) / 10;
+}
+
+float PseudoRandomSequence(uint64_t seed,
+                           uint64_t* state,
+                           float value,
+                           size_t index) {
   if (index == 0) {
     // start of loop, reset to initial seed which was passed in and is based on
     // the domain key
-    v = seed;
+    *state = seed;
   }
   // get next value in PRNG sequence
-  v = lfsr_next(v);
-  // return pseudo-random float between 0 and 0.1
-  return (v / maxUInt64AsDouble) / 10;
+  *state = lfsr_next(*state);
+  return PseudoRandomSample(*state);
 }
 
 }  // namespace
@@ -181,6 +190,16 @@ void BraveSessionCache::Init() {
   RegisterAllowFontFamilyCallback(base::BindRepeating(&brave::AllowFontFamily));
 }
 
+double BraveSessionCache::GetAudioFudgeFactor() const {
+  const uint64_t* fudge = reinterpret_cast<const uint64_t*>(domain_key_);
+  const double maxUInt64AsDouble = UINT64_MAX;
+  return 0.99 + ((*fudge / maxUInt64AsDouble) / 100);
+}
+
+uint64_t BraveSessionCache::GetAudioSeed() const {
+  return *reinterpret_cast<const uint64_t*>(domain_key_);
+}
+
 AudioFarblingCallback BraveSessionCache::GetAudioFarblingCallback(
     blink::WebContentSettingsClient* settings) {
   if (farbling_enabled_ && settings) {
@@ -189,22 +208,52 @@ AudioFarblingCallback BraveSessionCache::GetAudioFarblingCallback(
         break;
       }
       case BraveFarblingLevel::BALANCED: {
-        const uint64_t* fudge = reinterpret_cast<const uint64_t*>(domain_key_);
-        const double maxUInt64AsDouble = UINT64_MAX;
-        double fudge_factor = 0.99 + ((*fudge / maxUInt64AsDouble) / 100);
+        double fudge_factor = GetAudioFudgeFactor();
         VLOG(1) << "audio fudge factor (based on session token) = "
                 << fudge_factor;
         return base::BindRepeating(&ConstantMultiplier, fudge_factor);
       }
       case BraveFarblingLevel::MAXIMUM: {
-        uint64_t seed = *reinterpret_cast<uint64_t*>(domain_key_);
-        return base::BindRepeating(&PseudoRandomSequence, seed);
+        uint64_t seed = GetAudioSeed();
+        // The LFSR state belongs to this callback only.
+        return base::BindRepeating(&PseudoRandomSequence, seed,
+                                   base::Owned(new uint64_t(seed)));
       }
     }
   }
   return base::BindRepeating(&Identity);
 }
 
+void BraveSessionCache::FarbleAudioBuffer(
+    blink::WebContentSettingsClient* settings,
+    float* data,
+    size_t count) {
+  if (!farbling_enabled_ || !settings || !data)
+    return;
+  switch (settings->GetBraveFarblingLevel()) {
+    case BraveFarblingLevel::OFF:
+      break;
+    case BraveFarblingLevel::BALANCED: {
+      // Plain loop without calls in it, so the compiler vectorizes the
+      // multiplication. It is done in double precision like
+      // ConstantMultiplier to produce the same output.
+      const double fudge_factor = GetAudioFudgeFactor();
+      for (size_t i = 0; i < count; ++i)
+        data[i] = data[i] * fudge_factor;
+      break;
+    }
+    case BraveFarblingLevel::MAXIMUM: {
+      // Same sequence as PseudoRandomSequence, with the state kept local.
+      uint64_t v = GetAudioSeed();
+      for (size_t i = 0; i < count; ++i) {
+        v = lfsr_next(v);
+        data[i] = PseudoRandomSample(v);
+      }
+      break;
+    }
+  }
+}
+
 void BraveSessionCache::PerturbPixels(blink::WebContentSettingsClient* settings,
                                       const unsigned char* data,
                                       size_t size) {
@@ -237,14 +286,24 @@ void BraveSessionCache::PerturbPixelsInternal(const unsigned char* data,
   // Four bits per pixel
   const size_t pixel_count = size / 4;
   // calculate initial seed to find first pixel to perturb, based on session
-  // key, domain key, and canvas contents
+  // key, domain key, and canvas contents. The HMAC runs over a 32-bit
+  // unkeyed FastHash of the contents plus the canvas size instead of every
+  // byte of the canvas. The contents only vary the perturbation between
+  // canvases; what keeps it unpredictable to the page is the session and
+  // domain keys the HMAC is keyed with. Canvases whose contents collide get
+  // the same perturbation, which a page gains nothing from: it still can't
+  // tell which bits were flipped without the keys.
+  const uint64_t content_digest[2] = {
+      static_cast<uint64_t>(base::FastHash(base::make_span(pixels, size))),
+      static_cast<uint64_t>(size)};
   crypto::HMAC h(crypto::HMAC::SHA256);
   uint64_t session_plus_domain_key =
       session_key_ ^ *reinterpret_cast<uint64_t*>(domain_key_);
   CHECK(h.Init(reinterpret_cast<const unsigned char*>(&session_plus_domain_key),
                sizeof session_plus_domain_key));
   uint8_t canvas_key[32];
-  CHECK(h.Sign(base::StringPiece(reinterpret_cast<const char*>(pixels), size),
+  CHECK(h.Sign(base::StringPiece(reinterpret_cast<const char*>(content_digest),
+                                 sizeof content_digest),
                canvas_key, sizeof canvas_key));
   uint64_t v = *reinterpret_cast<uint64_t*>(canvas_key);
   uint64_t pixel_index;
@@ -50,6 +50,11 @@ class CORE_EXPORT BraveSessionCache final
 
   AudioFarblingCallback GetAudioFarblingCallback(
       blink::WebContentSettingsClient* settings);
+  // Farbles |count| samples in place. Gives the same result as running the
+  // callback above over the samples in order, without a call per sample.
+  void FarbleAudioBuffer(blink::WebContentSettingsClient* settings,
+                         float* data,
+                         size_t count);
   void PerturbPixels(blink::WebContentSettingsClient* settings,
                      const unsigned char* data,
                      size_t size);
@@ -65,6 +70,8 @@ class CORE_EXPORT BraveSessionCache final
   uint8_t domain_key_[32];
 
   void PerturbPixelsInternal(const unsigned char* data, size_t size);
+  double GetAudioFudgeFactor() const;
+  uint64_t GetAudioSeed() const;
 };
 }  // namespace brave
 
@@ -16,6 +16,12 @@
  */
 typedef struct C_Engine C_Engine;
 
+/**
+ * A list of `Resource`s parsed from JSON, which can be applied to any number of
+ * engines.
+ */
+typedef struct C_ResourceList C_ResourceList;
+
 /**
  * An external callback that receives a hostname and two out-parameters for
  * start and end position. The callback should fill the start and end positions
@@ -92,6 +98,23 @@ bool engine_add_resource(struct C_Engine* engine,
  */
 void engine_add_resources(struct C_Engine* engine, const char* resources);
 
+/**
+ * Parses a list of `Resource`s from JSON format once, so it can be shared
+ * between engines.
+ */
+struct C_ResourceList* resource_list_create(const char* resources);
+
+/**
+ * Uses a previously parsed `ResourceList` as the engine's resources
+ */
+void engine_use_resource_list(struct C_Engine* engine,
+                              const struct C_ResourceList* resource_list);
+
+/**
+ * Destroy a `ResourceList` once you are done with it.
+ */
+void resource_list_destroy(struct C_ResourceList* resource_list);
+
 /**
  * Removes a tag to the engine for consideration
  */
@@ -134,4 +157,26 @@ char* engine_hidden_class_id_selectors(struct C_Engine* engine,
                                        const char* const* exceptions,
                                        size_t exceptions_size);
 
+/**
+ * Same as `engine_hidden_class_id_selectors`, but returns the selectors as an
+ * array of `selectors_size` C strings instead of a JSON-encoded list, so
+ * callers don't need to parse the result.
+ *
+ * The returned array must be destroyed with `c_char_array_destroy`.
+ */
+char** engine_hidden_class_id_selector_list(struct C_Engine* engine,
+                                            const char* const* classes,
+                                            size_t classes_size,
+                                            const char* const* ids,
+                                            size_t ids_size,
+                                            const char* const* exceptions,
+                                            size_t exceptions_size,
+                                            size_t* selectors_size);
+
+/**
+ * Destroy an array of `*c_char` returned by the engine once you are done with
+ * it.
+ */
+void c_char_array_destroy(char** array, size_t size);
+
 #endif /* BRAVE_COMPONENTS_ADBLOCK_RUST_FFI_SRC_LIB_H_ */
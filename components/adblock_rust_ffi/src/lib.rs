@@ -187,19 +187,52 @@ pub unsafe extern "C" fn engine_add_resource(
     engine.add_resource(resource).is_ok()
 }
 
-/// Adds a list of `Resource`s from JSON format
-#[no_mangle]
-pub unsafe extern "C" fn engine_add_resources(engine: *mut Engine, resources: *const c_char) {
+/// A list of `Resource`s parsed from JSON, which can be applied to any number of engines.
+pub struct ResourceList(Vec<Resource>);
+
+unsafe fn parse_resources(resources: *const c_char) -> Vec<Resource> {
     let resources = CStr::from_ptr(resources).to_str().unwrap();
-    let resources: Vec<Resource> = serde_json::from_str(resources).unwrap_or_else(|e| {
+    serde_json::from_str(resources).unwrap_or_else(|e| {
         eprintln!("Failed to parse JSON adblock resources: {}", e);
         vec![]
-    });
+    })
+}
+
+/// Adds a list of `Resource`s from JSON format
+#[no_mangle]
+pub unsafe extern "C" fn engine_add_resources(engine: *mut Engine, resources: *const c_char) {
+    let resources = parse_resources(resources);
     assert!(!engine.is_null());
     let engine = Box::leak(Box::from_raw(engine));
     engine.use_resources(&resources);
 }
 
+/// Parses a list of `Resource`s from JSON format once, so it can be shared between engines.
+#[no_mangle]
+pub unsafe extern "C" fn resource_list_create(resources: *const c_char) -> *mut ResourceList {
+    Box::into_raw(Box::new(ResourceList(parse_resources(resources))))
+}
+
+/// Uses a previously parsed `ResourceList` as the engine's resources
+#[no_mangle]
+pub unsafe extern "C" fn engine_use_resource_list(
+    engine: *mut Engine,
+    resource_list: *const ResourceList,
+) {
+    assert!(!engine.is_null());
+    assert!(!resource_list.is_null());
+    let engine = Box::leak(Box::from_raw(engine));
+    engine.use_resources(&(*resource_list).0);
+}
+
+/// Destroy a `ResourceList` once you are done with it.
+#[no_mangle]
+pub unsafe extern "C" fn resource_list_destroy(resource_list: *mut ResourceList) {
+    if !resource_list.is_null() {
+        drop(Box::from_raw(resource_list));
+    }
+}
+
 /// Removes a tag to the engine for consideration
 #[no_mangle]
 pub unsafe extern "C" fn engine_remove_tag(engine: *mut Engine, tag: *const c_char) {
@@ -271,22 +304,85 @@ pub unsafe extern "C" fn engine_hidden_class_id_selectors(
     exceptions: *const *const c_char,
     exceptions_size: size_t,
 ) -> *mut c_char {
-    let classes = std::slice::from_raw_parts(classes, classes_size);
-    let classes: Vec<String> = (0..classes_size)
-        .map(|index| CStr::from_ptr(classes[index]).to_str().unwrap().to_owned())
-        .collect();
-    let ids = std::slice::from_raw_parts(ids, ids_size);
-    let ids: Vec<String> = (0..ids_size)
-        .map(|index| CStr::from_ptr(ids[index]).to_str().unwrap().to_owned())
-        .collect();
-    let exceptions = std::slice::from_raw_parts(exceptions, exceptions_size);
-    let exceptions: std::collections::HashSet<String> = (0..exceptions_size)
-        .map(|index| CStr::from_ptr(exceptions[index]).to_str().unwrap().to_owned())
-        .collect();
-    assert!(!engine.is_null());
-    let engine = Box::leak(Box::from_raw(engine));
-    let stylesheet = engine.hidden_class_id_selectors(&classes, &ids, &exceptions);
+    let stylesheet = hidden_class_id_selectors(
+        engine,
+        classes,
+        classes_size,
+        ids,
+        ids_size,
+        exceptions,
+        exceptions_size,
+    );
     CString::new(serde_json::to_string(&stylesheet).unwrap_or_else(|_| "".into()))
         .expect("Error: CString::new()")
         .into_raw()
 }
+
+/// Same as `engine_hidden_class_id_selectors`, but returns the selectors as an array of
+/// `selectors_size` C strings instead of a JSON-encoded list, so callers don't need to parse the
+/// result.
+///
+/// The returned array must be destroyed with `c_char_array_destroy`.
+#[no_mangle]
+pub unsafe extern "C" fn engine_hidden_class_id_selector_list(
+    engine: *mut Engine,
+    classes: *const *const c_char,
+    classes_size: size_t,
+    ids: *const *const c_char,
+    ids_size: size_t,
+    exceptions: *const *const c_char,
+    exceptions_size: size_t,
+    selectors_size: *mut size_t,
+) -> *mut *mut c_char {
+    let selectors = hidden_class_id_selectors(
+        engine,
+        classes,
+        classes_size,
+        ids,
+        ids_size,
+        exceptions,
+        exceptions_size,
+    );
+    let selectors: Box<[*mut c_char]> = selectors
+        .into_iter()
+        .filter_map(|selector| CString::new(selector).ok())
+        .map(CString::into_raw)
+        .collect();
+    assert!(!selectors_size.is_null());
+    *selectors_size = selectors.len();
+    Box::into_raw(selectors) as *mut *mut c_char
+}
+
+/// Destroy an array of `*c_char` returned by the engine once you are done with it.
+#[no_mangle]
+pub unsafe extern "C" fn c_char_array_destroy(array: *mut *mut c_char, size: size_t) {
+    if !array.is_null() {
+        let array = Box::from_raw(std::slice::from_raw_parts_mut(array, size));
+        for s in array.iter() {
+            drop(CString::from_raw(*s));
+        }
+    }
+}
+
+unsafe fn c_str_array_to_vec(array: *const *const c_char, size: size_t) -> Vec<String> {
+    let array = std::slice::from_raw_parts(array, size);
+    array.iter().map(|s| CStr::from_ptr(*s).to_str().unwrap().to_owned()).collect()
+}
+
+unsafe fn hidden_class_id_selectors(
+    engine: *mut Engine,
+    classes: *const *const c_char,
+    classes_size: size_t,
+    ids: *const *const c_char,
+    ids_size: size_t,
+    exceptions: *const *const c_char,
+    exceptions_size: size_t,
+) -> Vec<String> {
+    let classes = c_str_array_to_vec(classes, classes_size);
+    let ids = c_str_array_to_vec(ids, ids_size);
+    let exceptions: std::collections::HashSet<String> =
+        c_str_array_to_vec(exceptions, exceptions_size).into_iter().collect();
+    assert!(!engine.is_null());
+    let engine = Box::leak(Box::from_raw(engine));
+    engine.hidden_class_id_selectors(&classes, &ids, &exceptions)
+}
@@ -10,6 +10,19 @@ extern "C" {
 #include "lib.h"  // NOLINT
 }
 
+namespace {
+
+std::vector<const char*> ToRawStrings(const std::vector<std::string>& strings) {
+  std::vector<const char*> strings_raw;
+  strings_raw.reserve(strings.size());
+  for (const auto& string : strings) {
+    strings_raw.push_back(string.c_str());
+  }
+  return strings_raw;
+}
+
+}  // namespace
+
 namespace adblock {
 
 bool SetDomainResolver(DomainResolverCallback resolver) {
@@ -40,6 +53,13 @@ FilterList::FilterList(const FilterList& other) = default;
 
 FilterList::~FilterList() {}
 
+ResourceList::ResourceList(const std::string& resources)
+    : raw(resource_list_create(resources.c_str())) {}
+
+ResourceList::~ResourceList() {
+  resource_list_destroy(raw);
+}
+
 Engine::Engine() : raw(engine_create("")) {}
 
 Engine::Engine(const std::string& rules) : raw(engine_create(rules.c_str())) {}
@@ -108,6 +128,10 @@ void Engine::addResources(const std::string& resources) {
   engine_add_resources(raw, resources.c_str());
 }
 
+void Engine::useResources(const ResourceList& resources) {
+  engine_use_resource_list(raw, resources.raw);
+}
+
 const std::string Engine::urlCosmeticResources(const std::string& url) {
   char* resources_raw = engine_url_cosmetic_resources(raw, url.c_str());
   const std::string resources_json = std::string(resources_raw);
@@ -120,23 +144,9 @@ const std::string Engine::hiddenClassIdSelectors(
     const std::vector<std::string>& classes,
     const std::vector<std::string>& ids,
     const std::vector<std::string>& exceptions) {
-  std::vector<const char*> classes_raw;
-  classes_raw.reserve(classes.size());
-  for (size_t i = 0; i < classes.size(); i++) {
-    classes_raw.push_back(classes[i].c_str());
-  }
-
-  std::vector<const char*> ids_raw;
-  ids_raw.reserve(ids.size());
-  for (size_t i = 0; i < ids.size(); i++) {
-    ids_raw.push_back(ids[i].c_str());
-  }
-
-  std::vector<const char*> exceptions_raw;
-  exceptions_raw.reserve(exceptions.size());
-  for (size_t i = 0; i < exceptions.size(); i++) {
-    exceptions_raw.push_back(exceptions[i].c_str());
-  }
+  const std::vector<const char*> classes_raw = ToRawStrings(classes);
+  const std::vector<const char*> ids_raw = ToRawStrings(ids);
+  const std::vector<const char*> exceptions_raw = ToRawStrings(exceptions);
 
   char* stylesheet_raw = engine_hidden_class_id_selectors(
       raw, classes_raw.data(), classes.size(), ids_raw.data(), ids.size(),
@@ -147,6 +157,25 @@ const std::string Engine::hiddenClassIdSelectors(
   return stylesheet;
 }
 
+std::vector<std::string> Engine::hiddenClassIdSelectorList(
+    const std::vector<std::string>& classes,
+    const std::vector<std::string>& ids,
+    const std::vector<std::string>& exceptions) {
+  const std::vector<const char*> classes_raw = ToRawStrings(classes);
+  const std::vector<const char*> ids_raw = ToRawStrings(ids);
+  const std::vector<const char*> exceptions_raw = ToRawStrings(exceptions);
+
+  size_t selectors_size = 0;
+  char** selectors_raw = engine_hidden_class_id_selector_list(
+      raw, classes_raw.data(), classes.size(), ids_raw.data(), ids.size(),
+      exceptions_raw.data(), exceptions.size(), &selectors_size);
+  std::vector<std::string> selectors(selectors_raw,
+                                     selectors_raw + selectors_size);
+
+  c_char_array_destroy(selectors_raw, selectors_size);
+  return selectors;
+}
+
 Engine::~Engine() {
   engine_destroy(raw);
 }
@@ -66,6 +66,19 @@ class ADBLOCK_EXPORT FilterList {
   static std::vector<FilterList> regional_list;
 };
 
+class ADBLOCK_EXPORT ResourceList {
+ public:
+  explicit ResourceList(const std::string& resources);
+  ~ResourceList();
+
+ private:
+  friend class Engine;
+
+  ResourceList(const ResourceList&) = delete;
+  void operator=(const ResourceList&) = delete;
+  raw_ptr<C_ResourceList> raw = nullptr;
+};
+
 class ADBLOCK_EXPORT Engine {
  public:
   Engine();
@@ -91,6 +104,7 @@ class ADBLOCK_EXPORT Engine {
                    const std::string& content_type,
                    const std::string& data);
   void addResources(const std::string& resources);
+  void useResources(const ResourceList& resources);
   void removeTag(const std::string& tag);
   bool tagExists(const std::string& tag);
   const std::string urlCosmeticResources(const std::string& url);
@@ -98,6 +112,11 @@ class ADBLOCK_EXPORT Engine {
       const std::vector<std::string>& classes,
       const std::vector<std::string>& ids,
       const std::vector<std::string>& exceptions);
+  // Same as hiddenClassIdSelectors, without the JSON round trip.
+  std::vector<std::string> hiddenClassIdSelectorList(
+      const std::vector<std::string>& classes,
+      const std::vector<std::string>& ids,
+      const std::vector<std::string>& exceptions);
   ~Engine();
 
  private:
@@ -7,10 +7,12 @@
 
 #include <memory>
 #include <string>
+#include <utility>
 
 #include "base/logging.h"
 #include "base/files/file_path.h"
 #include "base/files/file_util.h"
+#include "base/task/thread_pool.h"
 
 namespace {
 
@@ -45,6 +47,43 @@ DATFileDataBuffer ReadDATFileData(const base::FilePath& dat_file_path) {
   return buffer;
 }
 
+DATFileData::DATFileData()
+    : base::RefCountedDeleteOnSequence<DATFileData>(
+          base::ThreadPool::CreateSequencedTaskRunner(
+              {base::MayBlock(), base::TaskPriority::BEST_EFFORT,
+               base::TaskShutdownBehavior::CONTINUE_ON_SHUTDOWN})) {}
+
+DATFileData::~DATFileData() = default;
+
+// static
+scoped_refptr<DATFileData> DATFileData::MapFile(
+    const base::FilePath& dat_file_path) {
+  scoped_refptr<DATFileData> dat_data =
+      base::WrapRefCounted(new DATFileData());
+  if (!dat_data->mapped_file_.Initialize(dat_file_path) ||
+      dat_data->mapped_file_.length() == 0) {
+    LOG(ERROR) << "MapFile: the dat file is not found or corrupted "
+               << dat_file_path;
+  }
+  return dat_data;
+}
+
+// static
+scoped_refptr<DATFileData> DATFileData::FromBuffer(DATFileDataBuffer buffer) {
+  scoped_refptr<DATFileData> dat_data =
+      base::WrapRefCounted(new DATFileData());
+  dat_data->buffer_ = std::move(buffer);
+  return dat_data;
+}
+
+const unsigned char* DATFileData::data() const {
+  return mapped_file_.IsValid() ? mapped_file_.data() : buffer_.data();
+}
+
+size_t DATFileData::size() const {
+  return mapped_file_.IsValid() ? mapped_file_.length() : buffer_.size();
+}
+
 std::string GetDATFileAsString(const base::FilePath& file_path) {
   std::string contents;
   bool success = base::ReadFileToString(file_path, &contents);
@@ -12,11 +12,45 @@
 #include <vector>
 
 #include "base/files/file_path.h"
+#include "base/files/memory_mapped_file.h"
+#include "base/memory/ref_counted_delete_on_sequence.h"
+#include "base/memory/scoped_refptr.h"
 
 namespace brave_component_updater {
 
 using DATFileDataBuffer = std::vector<unsigned char>;
 
+// Immutable, ref-counted DAT file contents. When loaded from disk the bytes
+// are a read-only mapping of the file, so they stay in the page cache instead
+// of being copied onto the heap, and every consumer of a load shares one view.
+// Destruction is bounced to a blocking-allowed sequence because unmapping
+// closes the underlying file.
+class DATFileData : public base::RefCountedDeleteOnSequence<DATFileData> {
+ public:
+  DATFileData(const DATFileData&) = delete;
+  DATFileData& operator=(const DATFileData&) = delete;
+
+  // Maps |dat_file_path|. Never returns null; the result is empty if the file
+  // is missing, empty or cannot be mapped.
+  static scoped_refptr<DATFileData> MapFile(
+      const base::FilePath& dat_file_path);
+  static scoped_refptr<DATFileData> FromBuffer(DATFileDataBuffer buffer);
+
+  const unsigned char* data() const;
+  size_t size() const;
+  bool empty() const { return size() == 0; }
+
+ private:
+  friend class base::RefCountedDeleteOnSequence<DATFileData>;
+  friend class base::DeleteHelper<DATFileData>;
+
+  DATFileData();
+  ~DATFileData();
+
+  base::MemoryMappedFile mapped_file_;
+  DATFileDataBuffer buffer_;
+};
+
 std::string GetDATFileAsString(const base::FilePath& file_path);
 
 DATFileDataBuffer ReadDATFileData(const base::FilePath& dat_file_path);
@@ -81,14 +81,31 @@ bool AdNotificationTimingDataStore::AddLog(
     const AdNotificationTimingTaskLog& log) {
   DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
 
-  sql::Statement s(db_.GetUniqueStatement(
+  return AddLogs(base::make_span(&log, 1u));
+}
+
+bool AdNotificationTimingDataStore::AddLogs(
+    base::span<const AdNotificationTimingTaskLog> logs) {
+  DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
+
+  sql::Transaction transaction(&db_);
+  if (!transaction.Begin())
+    return false;
+
+  sql::Statement s(GetCachedStatement(
+      SQL_FROM_HERE,
       base::StringPrintf(
           "INSERT INTO %s (time, locale, number_of_tabs, label, creation_date) "
           "VALUES (?,?,?,?,?)",
-          task_name_.c_str())
-          .c_str()));
-  BindSampleLogToStatement(log, &s);
-  return s.Run();
+          task_name_.c_str())));
+  for (const auto& log : logs) {
+    s.Reset(true);
+    BindSampleLogToStatement(log, &s);
+    if (!s.Run())
+      return false;
+  }
+
+  return transaction.Commit();
 }
 
 AdNotificationTimingDataStore::IdToAdNotificationTimingTaskLogMap
@@ -9,6 +9,7 @@
 #include <string>
 
 #include "base/containers/flat_map.h"
+#include "base/containers/span.h"
 #include "base/files/file_path.h"
 #include "base/sequence_checker.h"
 #include "base/time/time.h"
@@ -67,6 +68,8 @@ class AdNotificationTimingDataStore final : public DataStore {
   using DataStore::DeleteLogs;
 
   bool AddLog(const AdNotificationTimingTaskLog& log);
+  // Adds all |logs| in a single transaction. Nothing is added on failure.
+  bool AddLogs(base::span<const AdNotificationTimingTaskLog> logs);
   IdToAdNotificationTimingTaskLogMap LoadLogs();
   bool EnsureTable() override;
 
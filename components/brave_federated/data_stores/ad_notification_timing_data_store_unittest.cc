@@ -6,6 +6,7 @@
 #include "brave/components/brave_federated/data_stores/ad_notification_timing_data_store.h"
 
 #include <string>
+#include <vector>
 
 #include "base/files/scoped_temp_dir.h"
 #include "base/path_service.h"
@@ -111,6 +112,8 @@ TEST_F(AdNotificationTimingDataStoreTest, CheckSchemaColumnExistence) {
       "ad_notification_timing_federated_task", "label"));
   ASSERT_TRUE(ad_notification_data_store_->db_.DoesColumnExist(
       "ad_notification_timing_federated_task", "creation_date"));
+  ASSERT_TRUE(ad_notification_data_store_->db_.DoesIndexExist(
+      "ad_notification_timing_federated_task_creation_date_index"));
 }
 
 TEST_F(AdNotificationTimingDataStoreTest, AddLog) {
@@ -126,6 +129,27 @@ TEST_F(AdNotificationTimingDataStoreTest, AddLog) {
   EXPECT_EQ(2U, CountRecords());
 }
 
+TEST_F(AdNotificationTimingDataStoreTest, AddLogs) {
+  ClearDB();
+  std::vector<AdNotificationTimingTaskLog> logs;
+  for (size_t i = 0; i < base::size(ad_notification_task_log_test_db); ++i) {
+    logs.push_back(AdNotificationTimingTaskLogFromTestInfo(
+        ad_notification_task_log_test_db[i]));
+  }
+  EXPECT_TRUE(ad_notification_data_store_->AddLogs(logs));
+  EXPECT_EQ(base::size(ad_notification_task_log_test_db), CountRecords());
+
+  // The cached insert statement is reused for later batches.
+  EXPECT_TRUE(ad_notification_data_store_->AddLogs(logs));
+  EXPECT_EQ(2 * base::size(ad_notification_task_log_test_db), CountRecords());
+
+  auto loaded_logs = ad_notification_data_store_->LoadLogs();
+  ASSERT_EQ(2 * base::size(ad_notification_task_log_test_db),
+            loaded_logs.size());
+  EXPECT_EQ("GB", loaded_logs.find(3)->second.locale);
+  EXPECT_EQ("GB", loaded_logs.find(7)->second.locale);
+}
+
 TEST_F(AdNotificationTimingDataStoreTest, LoadLogs) {
   AddAll();
   EXPECT_EQ(4U, CountRecords());
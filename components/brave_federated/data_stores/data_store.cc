@@ -70,7 +70,8 @@ bool DataStore::Init(int task_id,
       base::BindRepeating(&DatabaseErrorCallback, &db_, database_path_));
 
   // Attach the database to our index file.
-  return db_.Open(database_path_) && EnsureTable();
+  return db_.Open(database_path_) && EnsureTable() &&
+         EnsureCreationDateIndex();
 }
 
 DataStore::~DataStore() {}
@@ -89,11 +90,15 @@ bool DataStore::DeleteLogs() {
 void DataStore::EnforceRetentionPolicy() {
   DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
 
-  sql::Statement s(db_.GetUniqueStatement(
-      base::StringPrintf(" DELETE FROM %s WHERE creation_date < ? OR id NOT IN "
-                         "(SELECT id FROM %s ORDER BY id DESC LIMIT ?)",
-                         task_name_.c_str(), task_name_.c_str())
-          .c_str()));
+  // Ids only grow, so the newest |max_number_of_records_| rows are the ones
+  // above the id found at that offset from the top. Both lookups use an
+  // index instead of comparing every row against a subquery result.
+  sql::Statement s(GetCachedStatement(
+      SQL_FROM_HERE,
+      base::StringPrintf("DELETE FROM %s WHERE creation_date < ? OR id <= "
+                         "(SELECT id FROM %s ORDER BY id DESC LIMIT 1 "
+                         "OFFSET ?)",
+                         task_name_.c_str(), task_name_.c_str())));
   base::Time expiration_threshold =
       base::Time::Now() - base::Seconds(max_retention_days_ * 24 * 60 * 60);
   s.BindInt64(0, expiration_threshold.ToInternalValue());
@@ -101,6 +106,20 @@ void DataStore::EnforceRetentionPolicy() {
   s.Run();
 }
 
+sql::Statement DataStore::GetCachedStatement(sql::StatementID id,
+                                             const std::string& sql) {
+  DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
+  return sql::Statement(db_.GetCachedStatement(id, sql.c_str()));
+}
+
+bool DataStore::EnsureCreationDateIndex() {
+  return db_.Execute(
+      base::StringPrintf("CREATE INDEX IF NOT EXISTS %s_creation_date_index "
+                         "ON %s (creation_date)",
+                         task_name_.c_str(), task_name_.c_str())
+          .c_str());
+}
+
 bool DataStore::EnsureTable() {
   return false;
 }
@@ -13,6 +13,8 @@
 #include "base/gtest_prod_util.h"
 #include "base/sequence_checker.h"
 #include "sql/database.h"
+#include "sql/statement.h"
+#include "sql/statement_id.h"
 
 namespace brave_federated {
 
@@ -41,6 +43,13 @@ class DataStore {
   FRIEND_TEST_ALL_PREFIXES(AdNotificationTimingDataStoreTest,
                            CheckSchemaColumnExistence);
 
+  // Returns a statement that stays prepared as long as |db_| is open, so that
+  // statements run per log are only compiled once. Use SQL_FROM_HERE for
+  // |id|; each store owns its database, so the table name baked into |sql|
+  // is the same for every call from a given call site.
+  sql::Statement GetCachedStatement(sql::StatementID id,
+                                    const std::string& sql);
+
   sql::Database db_;
   base::FilePath database_path_;
 
@@ -51,6 +60,9 @@ class DataStore {
 
  private:
   virtual bool EnsureTable();
+  // Retention is enforced by creation date, so every task table gets an
+  // index on it.
+  bool EnsureCreationDateIndex();
 
   SEQUENCE_CHECKER(sequence_checker_);
 };
@@ -117,4 +117,26 @@ TEST_F(DataStoreTest, EnforceRetentionPolicy) {
   EXPECT_TRUE(it == test_task_logs.end());
 }
 
+TEST_F(DataStoreTest, EnforceRetentionPolicyKeepsNewestRecords) {
+  base::FilePath db_path(
+      temp_dir_.GetPath().Append(FILE_PATH_LITERAL("capped_data_store")));
+  TestDataStore capped_data_store(db_path);
+  ASSERT_TRUE(capped_data_store.Init(0, "capped_federated_task", 2, 30));
+  for (int i = 0; i < 5; ++i)
+    EXPECT_TRUE(
+        capped_data_store.AddLog(TestTaskLog(0, true, base::Time::Now())));
+
+  capped_data_store.EnforceRetentionPolicy();
+  TestDataStore::TestTaskLogMap test_task_logs;
+  capped_data_store.LoadLogs(&test_task_logs);
+  ASSERT_EQ(2U, test_task_logs.size());
+  EXPECT_TRUE(test_task_logs.find(4) != test_task_logs.end());
+  EXPECT_TRUE(test_task_logs.find(5) != test_task_logs.end());
+
+  // Nothing is removed while under the cap.
+  capped_data_store.EnforceRetentionPolicy();
+  capped_data_store.LoadLogs(&test_task_logs);
+  EXPECT_EQ(2U, test_task_logs.size());
+}
+
 }  // namespace brave_federated
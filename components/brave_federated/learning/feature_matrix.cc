@@ -0,0 +1,78 @@
+/* Copyright (c) 2022 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/brave_federated/learning/feature_matrix.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "base/check_op.h"
+#include "base/numerics/math_constants.h"
+#include "base/time/time.h"
+
+namespace {
+
+// Tab counts are log scaled and divided by this, so that typical counts end
+// up in the [0, 1] range.
+constexpr float kTabCountScale = 5.0f;
+
+}  // namespace
+
+namespace brave_federated {
+
+FeatureMatrix::FeatureMatrix(size_t feature_count) : columns_(feature_count) {}
+
+FeatureMatrix::FeatureMatrix(FeatureMatrix&& other) = default;
+
+FeatureMatrix& FeatureMatrix::operator=(FeatureMatrix&& other) = default;
+
+FeatureMatrix::~FeatureMatrix() = default;
+
+// static
+FeatureMatrix FeatureMatrix::FromAdNotificationTimingLogs(
+    const AdNotificationTimingDataStore::IdToAdNotificationTimingTaskLogMap&
+        logs) {
+  FeatureMatrix matrix(kAdNotificationTimingFeatureCount);
+  for (auto& column : matrix.columns_)
+    column.reserve(logs.size());
+  matrix.labels_.reserve(logs.size());
+
+  for (const auto& item : logs) {
+    const AdNotificationTimingTaskLog& log = item.second;
+    base::Time::Exploded exploded;
+    log.time.LocalExplode(&exploded);
+    const float hour_angle =
+        2.0f * base::kPiFloat * (exploded.hour + exploded.minute / 60.0f) /
+        24.0f;
+    const bool is_weekend =
+        exploded.day_of_week == 0 || exploded.day_of_week == 6;
+
+    const float features[kAdNotificationTimingFeatureCount] = {
+        1.0f,
+        std::sin(hour_angle),
+        std::cos(hour_angle),
+        is_weekend ? 1.0f : 0.0f,
+        std::log1p(static_cast<float>(std::max(log.number_of_tabs, 0))) /
+            kTabCountScale,
+    };
+    matrix.AddSample(features, log.label ? 1.0f : 0.0f);
+  }
+
+  return matrix;
+}
+
+void FeatureMatrix::AddSample(base::span<const float> features, float label) {
+  DCHECK_EQ(features.size(), columns_.size());
+  for (size_t i = 0; i < columns_.size(); ++i)
+    columns_[i].push_back(features[i]);
+  labels_.push_back(label);
+}
+
+base::span<const float> FeatureMatrix::column(size_t feature) const {
+  DCHECK_LT(feature, columns_.size());
+  return columns_[feature];
+}
+
+}  // namespace brave_federated
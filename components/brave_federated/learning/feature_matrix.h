@@ -0,0 +1,53 @@
+/* Copyright (c) 2022 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#ifndef BRAVE_COMPONENTS_BRAVE_FEDERATED_LEARNING_FEATURE_MATRIX_H_
+#define BRAVE_COMPONENTS_BRAVE_FEDERATED_LEARNING_FEATURE_MATRIX_H_
+
+#include <vector>
+
+#include "base/containers/span.h"
+#include "brave/components/brave_federated/data_stores/ad_notification_timing_data_store.h"
+
+namespace brave_federated {
+
+// FeatureMatrix holds the model inputs of a training round in column-major
+// order, so that per-feature passes over all samples walk contiguous memory.
+// Every sample also carries a label in the [0, 1] range.
+class FeatureMatrix final {
+ public:
+  explicit FeatureMatrix(size_t feature_count);
+  FeatureMatrix(FeatureMatrix&& other);
+  FeatureMatrix& operator=(FeatureMatrix&& other);
+  ~FeatureMatrix();
+
+  FeatureMatrix(const FeatureMatrix&) = delete;
+  FeatureMatrix& operator=(const FeatureMatrix&) = delete;
+
+  // Features of the ad notification timing task: a bias term, the hour of
+  // delivery encoded on the unit circle, whether it was delivered on a
+  // weekend and the scaled number of open tabs.
+  static constexpr size_t kAdNotificationTimingFeatureCount = 5;
+  static FeatureMatrix FromAdNotificationTimingLogs(
+      const AdNotificationTimingDataStore::IdToAdNotificationTimingTaskLogMap&
+          logs);
+
+  // |features| must have |feature_count()| elements.
+  void AddSample(base::span<const float> features, float label);
+
+  size_t feature_count() const { return columns_.size(); }
+  size_t sample_count() const { return labels_.size(); }
+
+  base::span<const float> column(size_t feature) const;
+  base::span<const float> labels() const { return labels_; }
+
+ private:
+  std::vector<std::vector<float>> columns_;
+  std::vector<float> labels_;
+};
+
+}  // namespace brave_federated
+
+#endif  // BRAVE_COMPONENTS_BRAVE_FEDERATED_LEARNING_FEATURE_MATRIX_H_
@@ -0,0 +1,129 @@
+/* Copyright (c) 2022 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/brave_federated/learning/learning_service.h"
+
+#include <utility>
+
+#include "base/bind.h"
+#include "base/logging.h"
+#include "base/task/thread_pool.h"
+#include "brave/components/brave_federated/data_store_service.h"
+#include "brave/components/brave_federated/data_stores/ad_notification_timing_data_store.h"
+#include "brave/components/brave_federated/eligibility_service.h"
+#include "brave/components/brave_federated/learning/feature_matrix.h"
+#include "brave/components/brave_federated/learning/logistic_regression.h"
+
+namespace brave_federated {
+
+namespace {
+
+constexpr char kAdNotificationTimingTaskName[] =
+    "ad_notification_timing_federated_task";
+constexpr size_t kMinSampleCount = 10;
+constexpr int kEpochs = 50;
+constexpr float kLearningRate = 0.5f;
+
+ModelUpdate TrainAdNotificationTimingModel(
+    base::flat_map<int, AdNotificationTimingTaskLog> logs,
+    std::vector<float> weights) {
+  const FeatureMatrix data = FeatureMatrix::FromAdNotificationTimingLogs(logs);
+  LogisticRegression model(weights);
+
+  ModelUpdate update;
+  update.task_name = kAdNotificationTimingTaskName;
+  update.sample_count = data.sample_count();
+  update.loss = model.Train(data, kEpochs, kLearningRate);
+  update.weight_deltas.resize(weights.size());
+  for (size_t i = 0; i < weights.size(); ++i)
+    update.weight_deltas[i] = model.weights()[i] - weights[i];
+  return update;
+}
+
+}  // namespace
+
+// LearningService ------------------------------------------------------------
+
+LearningService::LearningService(DataStoreService* data_store_service,
+                                 EligibilityService* eligibility_service,
+                                 Aggregator* aggregator)
+    : data_store_service_(data_store_service),
+      eligibility_service_(eligibility_service),
+      aggregator_(aggregator),
+      model_weights_(FeatureMatrix::kAdNotificationTimingFeatureCount, 0.0f) {
+  DCHECK(data_store_service_);
+  DCHECK(eligibility_service_);
+  DCHECK(aggregator_);
+  eligibility_service_->AddObserver(this);
+}
+
+LearningService::~LearningService() {
+  eligibility_service_->RemoveObserver(this);
+}
+
+void LearningService::MaybeStartTraining() {
+  if (is_training_ || !eligibility_service_->IsEligibile())
+    return;
+
+  is_training_ = true;
+  data_store_service_->GetAdNotificationTimingDataStore()->LoadLogs(
+      base::BindOnce(&LearningService::OnLogsLoaded,
+                     weak_factory_.GetWeakPtr()));
+}
+
+bool LearningService::IsTraining() const {
+  return is_training_;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+void LearningService::OnEligibilityChanged(bool is_eligible) {
+  if (is_eligible)
+    MaybeStartTraining();
+}
+
+void LearningService::OnLogsLoaded(
+    base::flat_map<int, AdNotificationTimingTaskLog> logs) {
+  if (logs.size() < kMinSampleCount) {
+    VLOG(1) << "Not enough samples for federated training: " << logs.size();
+    is_training_ = false;
+    return;
+  }
+
+  base::ThreadPool::PostTaskAndReplyWithResult(
+      FROM_HERE,
+      {base::TaskPriority::BEST_EFFORT,
+       base::TaskShutdownBehavior::SKIP_ON_SHUTDOWN},
+      base::BindOnce(&TrainAdNotificationTimingModel, std::move(logs),
+                     model_weights_),
+      base::BindOnce(&LearningService::OnTrainingComplete,
+                     weak_factory_.GetWeakPtr()));
+}
+
+void LearningService::OnTrainingComplete(ModelUpdate update) {
+  if (!eligibility_service_->IsEligibile()) {
+    VLOG(1) << "Device became ineligible, dropping model update";
+    is_training_ = false;
+    return;
+  }
+
+  VLOG(1) << "Trained " << update.task_name << " on " << update.sample_count
+          << " samples, loss " << update.loss;
+  // The next round continues from what this one learned.
+  DCHECK_EQ(model_weights_.size(), update.weight_deltas.size());
+  for (size_t i = 0; i < model_weights_.size(); ++i)
+    model_weights_[i] += update.weight_deltas[i];
+
+  aggregator_->SubmitModelUpdate(
+      update, base::BindOnce(&LearningService::OnModelUpdateSubmitted,
+                             weak_factory_.GetWeakPtr()));
+}
+
+void LearningService::OnModelUpdateSubmitted(bool success) {
+  VLOG(1) << "Model update submitted: " << success;
+  is_training_ = false;
+}
+
+}  // namespace brave_federated
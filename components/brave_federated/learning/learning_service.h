@@ -0,0 +1,67 @@
+/* Copyright (c) 2022 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#ifndef BRAVE_COMPONENTS_BRAVE_FEDERATED_LEARNING_LEARNING_SERVICE_H_
+#define BRAVE_COMPONENTS_BRAVE_FEDERATED_LEARNING_LEARNING_SERVICE_H_
+
+#include <vector>
+
+#include "base/containers/flat_map.h"
+#include "base/memory/raw_ptr.h"
+#include "base/memory/weak_ptr.h"
+#include "brave/components/brave_federated/eligibility_service_observer.h"
+#include "brave/components/brave_federated/learning/model_update.h"
+
+namespace brave_federated {
+
+class DataStoreService;
+class EligibilityService;
+struct AdNotificationTimingTaskLog;
+
+// LearningService trains the ad notification timing model on the logs kept
+// in the local data store. A round loads the logs, trains on a background
+// thread, applies the weight deltas to |model_weights_| and hands them to the
+// |aggregator_|. Rounds only start
+// while |eligibility_service_| considers the device eligible, and updates of
+// a round that finishes after the device became ineligible are dropped.
+class LearningService final : public Observer {
+ public:
+  LearningService(DataStoreService* data_store_service,
+                  EligibilityService* eligibility_service,
+                  Aggregator* aggregator);
+  ~LearningService() override;
+
+  LearningService(const LearningService&) = delete;
+  LearningService& operator=(const LearningService&) = delete;
+
+  // Starts a training round unless one is in progress or the device is not
+  // eligible.
+  void MaybeStartTraining();
+  bool IsTraining() const;
+
+  const std::vector<float>& model_weights() const { return model_weights_; }
+
+ private:
+  // Observer:
+  void OnEligibilityChanged(bool is_eligible) override;
+
+  void OnLogsLoaded(base::flat_map<int, AdNotificationTimingTaskLog> logs);
+  void OnTrainingComplete(ModelUpdate update);
+  void OnModelUpdateSubmitted(bool success);
+
+  raw_ptr<DataStoreService> data_store_service_ = nullptr;    // NOT OWNED
+  raw_ptr<EligibilityService> eligibility_service_ = nullptr;  // NOT OWNED
+  raw_ptr<Aggregator> aggregator_ = nullptr;                   // NOT OWNED
+
+  // Weights the next round starts from.
+  std::vector<float> model_weights_;
+  bool is_training_ = false;
+
+  base::WeakPtrFactory<LearningService> weak_factory_{this};
+};
+
+}  // namespace brave_federated
+
+#endif  // BRAVE_COMPONENTS_BRAVE_FEDERATED_LEARNING_LEARNING_SERVICE_H_
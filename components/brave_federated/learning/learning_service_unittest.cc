@@ -0,0 +1,165 @@
+/* Copyright (c) 2022 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/brave_federated/learning/learning_service.h"
+
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "base/files/scoped_temp_dir.h"
+#include "base/test/task_environment.h"
+#include "brave/components/brave_federated/data_store_service.h"
+#include "brave/components/brave_federated/data_stores/ad_notification_timing_data_store.h"
+#include "brave/components/brave_federated/eligibility_service.h"
+#include "brave/components/brave_federated/learning/feature_matrix.h"
+#include "net/base/mock_network_change_notifier.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+// npm run test -- brave_unit_tests --filter=BraveFederatedLearningServiceTest*
+
+namespace brave_federated {
+
+namespace {
+
+// Stands in for a remote aggregation endpoint.
+class FakeAggregator : public Aggregator {
+ public:
+  void SubmitModelUpdate(const ModelUpdate& update,
+                         base::OnceCallback<void(bool)> callback) override {
+    updates_.push_back(update);
+    std::move(callback).Run(true);
+  }
+
+  const std::vector<ModelUpdate>& updates() const { return updates_; }
+
+ private:
+  std::vector<ModelUpdate> updates_;
+};
+
+}  // namespace
+
+class BraveFederatedLearningServiceTest : public testing::Test {
+ public:
+  void SetUp() override {
+    ASSERT_TRUE(temp_dir_.CreateUniqueTempDir());
+    network_change_notifier_ = net::test::MockNetworkChangeNotifier::Create();
+    SetConnectionType(net::NetworkChangeNotifier::CONNECTION_WIFI);
+
+    data_store_service_ = std::make_unique<DataStoreService>(
+        temp_dir_.GetPath().AppendASCII("data_store.sqlite"));
+    data_store_service_->Init();
+    eligibility_service_ = std::make_unique<EligibilityService>();
+    learning_service_ = std::make_unique<LearningService>(
+        data_store_service_.get(), eligibility_service_.get(), &aggregator_);
+    task_environment_.RunUntilIdle();
+  }
+
+  void TearDown() override {
+    learning_service_.reset();
+    eligibility_service_.reset();
+    data_store_service_.reset();
+    task_environment_.RunUntilIdle();
+  }
+
+  void SetConnectionType(net::NetworkChangeNotifier::ConnectionType type) {
+    network_change_notifier_->SetConnectionType(type);
+    net::NetworkChangeNotifier::NotifyObserversOfNetworkChangeForTests(type);
+    task_environment_.RunUntilIdle();
+  }
+
+  void AddLogs(int count) {
+    for (int i = 0; i < count; ++i) {
+      AdNotificationTimingTaskLog log(
+          0, base::Time::Now() - base::Hours(i), "US", i % 20, i % 3 == 0,
+          base::Time::Now());
+      data_store_service_->GetAdNotificationTimingDataStore()->AddLog(
+          log, base::BindOnce([](bool success) { EXPECT_TRUE(success); }));
+    }
+    task_environment_.RunUntilIdle();
+  }
+
+ protected:
+  base::test::TaskEnvironment task_environment_;
+  base::ScopedTempDir temp_dir_;
+  std::unique_ptr<net::test::MockNetworkChangeNotifier>
+      network_change_notifier_;
+  FakeAggregator aggregator_;
+  std::unique_ptr<DataStoreService> data_store_service_;
+  std::unique_ptr<EligibilityService> eligibility_service_;
+  std::unique_ptr<LearningService> learning_service_;
+};
+
+TEST_F(BraveFederatedLearningServiceTest, SubmitsModelUpdate) {
+  AddLogs(30);
+
+  learning_service_->MaybeStartTraining();
+  EXPECT_TRUE(learning_service_->IsTraining());
+  task_environment_.RunUntilIdle();
+  EXPECT_FALSE(learning_service_->IsTraining());
+
+  ASSERT_EQ(1U, aggregator_.updates().size());
+  const ModelUpdate& update = aggregator_.updates()[0];
+  EXPECT_EQ(30U, update.sample_count);
+  ASSERT_EQ(FeatureMatrix::kAdNotificationTimingFeatureCount,
+            update.weight_deltas.size());
+  EXPECT_GT(update.loss, 0.0f);
+  bool has_change = false;
+  for (float delta : update.weight_deltas)
+    has_change |= delta != 0.0f;
+  EXPECT_TRUE(has_change);
+}
+
+TEST_F(BraveFederatedLearningServiceTest, NextRoundStartsFromTrainedWeights) {
+  AddLogs(30);
+
+  learning_service_->MaybeStartTraining();
+  task_environment_.RunUntilIdle();
+  ASSERT_EQ(1U, aggregator_.updates().size());
+  const std::vector<float> first_round_weights =
+      learning_service_->model_weights();
+  EXPECT_EQ(aggregator_.updates()[0].weight_deltas, first_round_weights);
+
+  learning_service_->MaybeStartTraining();
+  task_environment_.RunUntilIdle();
+  ASSERT_EQ(2U, aggregator_.updates().size());
+  const ModelUpdate& first_update = aggregator_.updates()[0];
+  const ModelUpdate& second_update = aggregator_.updates()[1];
+
+  // Training on the same logs again picks up where the first round stopped.
+  EXPECT_LE(second_update.loss, first_update.loss);
+  const std::vector<float>& weights = learning_service_->model_weights();
+  ASSERT_EQ(first_round_weights.size(), weights.size());
+  for (size_t i = 0; i < weights.size(); ++i) {
+    EXPECT_FLOAT_EQ(first_round_weights[i] + second_update.weight_deltas[i],
+                    weights[i]);
+  }
+}
+
+TEST_F(BraveFederatedLearningServiceTest, SkipsTooFewSamples) {
+  AddLogs(3);
+
+  learning_service_->MaybeStartTraining();
+  task_environment_.RunUntilIdle();
+  EXPECT_FALSE(learning_service_->IsTraining());
+  EXPECT_TRUE(aggregator_.updates().empty());
+}
+
+TEST_F(BraveFederatedLearningServiceTest, RequiresEligibility) {
+  AddLogs(30);
+  SetConnectionType(net::NetworkChangeNotifier::CONNECTION_4G);
+
+  learning_service_->MaybeStartTraining();
+  EXPECT_FALSE(learning_service_->IsTraining());
+  task_environment_.RunUntilIdle();
+  EXPECT_TRUE(aggregator_.updates().empty());
+
+  // Becoming eligible starts a round on its own.
+  SetConnectionType(net::NetworkChangeNotifier::CONNECTION_WIFI);
+  task_environment_.RunUntilIdle();
+  EXPECT_EQ(1U, aggregator_.updates().size());
+}
+
+}  // namespace brave_federated
@@ -0,0 +1,106 @@
+/* Copyright (c) 2022 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/brave_federated/learning/logistic_regression.h"
+
+#include <algorithm>
+#include <cmath>
+#include <utility>
+
+#include "base/check_op.h"
+#include "brave/components/brave_federated/learning/feature_matrix.h"
+
+namespace {
+
+// Keeps log() away from zero when computing the loss.
+constexpr float kEpsilon = 1e-7f;
+
+float Sigmoid(float z) {
+  return 1.0f / (1.0f + std::exp(-z));
+}
+
+// |out| += |scale| * |in|
+void ScaleAndAdd(float scale,
+                 base::span<const float> in,
+                 base::span<float> out) {
+  DCHECK_EQ(in.size(), out.size());
+  const float* in_data = in.data();
+  float* out_data = out.data();
+  for (size_t i = 0; i < in.size(); ++i)
+    out_data[i] += scale * in_data[i];
+}
+
+}  // namespace
+
+namespace brave_federated {
+
+// Four independent accumulators let the compiler vectorize the reduction
+// without reassociating floating point math on its own.
+float DotProduct(base::span<const float> a, base::span<const float> b) {
+  DCHECK_EQ(a.size(), b.size());
+  const float* a_data = a.data();
+  const float* b_data = b.data();
+  const size_t size = a.size();
+  float sum[4] = {0.0f, 0.0f, 0.0f, 0.0f};
+  size_t i = 0;
+  for (; i + 4 <= size; i += 4) {
+    sum[0] += a_data[i] * b_data[i];
+    sum[1] += a_data[i + 1] * b_data[i + 1];
+    sum[2] += a_data[i + 2] * b_data[i + 2];
+    sum[3] += a_data[i + 3] * b_data[i + 3];
+  }
+  for (; i < size; ++i)
+    sum[0] += a_data[i] * b_data[i];
+  return (sum[0] + sum[1]) + (sum[2] + sum[3]);
+}
+
+LogisticRegression::LogisticRegression(std::vector<float> weights)
+    : weights_(std::move(weights)) {}
+
+LogisticRegression::~LogisticRegression() = default;
+
+float LogisticRegression::Train(const FeatureMatrix& data,
+                                int epochs,
+                                float learning_rate) {
+  DCHECK_EQ(data.feature_count(), weights_.size());
+  const size_t sample_count = data.sample_count();
+  if (sample_count == 0)
+    return 0.0f;
+
+  const base::span<const float> labels = data.labels();
+  std::vector<float> errors(sample_count);
+  float loss = 0.0f;
+  for (int epoch = 0; epoch < epochs; ++epoch) {
+    std::vector<float> predictions = Predict(data);
+
+    loss = 0.0f;
+    for (size_t i = 0; i < sample_count; ++i) {
+      errors[i] = predictions[i] - labels[i];
+      loss -= labels[i] * std::log(predictions[i] + kEpsilon) +
+              (1.0f - labels[i]) * std::log(1.0f - predictions[i] + kEpsilon);
+    }
+    loss /= sample_count;
+
+    const float step = learning_rate / sample_count;
+    for (size_t feature = 0; feature < weights_.size(); ++feature) {
+      weights_[feature] -= step * DotProduct(data.column(feature), errors);
+    }
+  }
+
+  return loss;
+}
+
+std::vector<float> LogisticRegression::Predict(
+    const FeatureMatrix& data) const {
+  DCHECK_EQ(data.feature_count(), weights_.size());
+  std::vector<float> scores(data.sample_count(), 0.0f);
+  for (size_t feature = 0; feature < weights_.size(); ++feature)
+    ScaleAndAdd(weights_[feature], data.column(feature), scores);
+
+  std::transform(scores.begin(), scores.end(), scores.begin(), Sigmoid);
+  return scores;
+}
+
+}  // namespace brave_federated
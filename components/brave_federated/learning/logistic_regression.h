@@ -0,0 +1,46 @@
+/* Copyright (c) 2022 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#ifndef BRAVE_COMPONENTS_BRAVE_FEDERATED_LEARNING_LOGISTIC_REGRESSION_H_
+#define BRAVE_COMPONENTS_BRAVE_FEDERATED_LEARNING_LOGISTIC_REGRESSION_H_
+
+#include <vector>
+
+#include "base/containers/span.h"
+
+namespace brave_federated {
+
+class FeatureMatrix;
+
+// Binary logistic regression trained with full batch gradient descent. All
+// passes run per feature column, which keeps the inner loops to plain dot
+// products and scaled additions over contiguous floats.
+class LogisticRegression final {
+ public:
+  explicit LogisticRegression(std::vector<float> weights);
+  ~LogisticRegression();
+
+  LogisticRegression(const LogisticRegression&) = delete;
+  LogisticRegression& operator=(const LogisticRegression&) = delete;
+
+  // Runs |epochs| passes over |data| and returns the mean log loss of the
+  // last pass. |data| must have one feature per weight.
+  float Train(const FeatureMatrix& data, int epochs, float learning_rate);
+
+  // Returns the predicted probability of a positive label for every sample.
+  std::vector<float> Predict(const FeatureMatrix& data) const;
+
+  const std::vector<float>& weights() const { return weights_; }
+
+ private:
+  std::vector<float> weights_;
+};
+
+// Exposed for testing.
+float DotProduct(base::span<const float> a, base::span<const float> b);
+
+}  // namespace brave_federated
+
+#endif  // BRAVE_COMPONENTS_BRAVE_FEDERATED_LEARNING_LOGISTIC_REGRESSION_H_
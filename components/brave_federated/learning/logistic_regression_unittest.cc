@@ -0,0 +1,73 @@
+/* Copyright (c) 2022 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/brave_federated/learning/logistic_regression.h"
+
+#include <vector>
+
+#include "brave/components/brave_federated/learning/feature_matrix.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+// npm run test -- brave_unit_tests --filter=BraveFederatedLearningTest*
+
+namespace brave_federated {
+
+TEST(BraveFederatedLearningTest, DotProduct) {
+  std::vector<float> a;
+  std::vector<float> b;
+  float expected = 0.0f;
+  // Odd length to cover the tail of the unrolled loop.
+  for (int i = 0; i < 11; ++i) {
+    a.push_back(i);
+    b.push_back(2 * i + 1);
+    expected += i * (2 * i + 1);
+  }
+  EXPECT_FLOAT_EQ(expected, DotProduct(a, b));
+  EXPECT_FLOAT_EQ(0.0f, DotProduct({}, {}));
+}
+
+TEST(BraveFederatedLearningTest, FeatureMatrixFromAdNotificationTimingLogs) {
+  AdNotificationTimingDataStore::IdToAdNotificationTimingTaskLogMap logs;
+  for (int i = 1; i <= 3; ++i) {
+    logs[i] = AdNotificationTimingTaskLog(i, base::Time::Now(), "US", i * 10,
+                                          i % 2, base::Time::Now());
+  }
+
+  const FeatureMatrix matrix =
+      FeatureMatrix::FromAdNotificationTimingLogs(logs);
+  ASSERT_EQ(FeatureMatrix::kAdNotificationTimingFeatureCount,
+            matrix.feature_count());
+  ASSERT_EQ(3U, matrix.sample_count());
+  for (size_t i = 0; i < matrix.feature_count(); ++i)
+    EXPECT_EQ(3U, matrix.column(i).size());
+  // Bias column.
+  EXPECT_FLOAT_EQ(1.0f, matrix.column(0)[2]);
+  // More tabs give a larger tab feature.
+  EXPECT_LT(matrix.column(4)[0], matrix.column(4)[2]);
+  EXPECT_FLOAT_EQ(1.0f, matrix.labels()[0]);
+  EXPECT_FLOAT_EQ(0.0f, matrix.labels()[1]);
+}
+
+TEST(BraveFederatedLearningTest, TrainSeparatesClasses) {
+  FeatureMatrix data(2);
+  for (int i = 0; i < 100; ++i) {
+    const float x = (i % 10) / 10.0f - 0.45f;
+    const float features[] = {1.0f, x};
+    data.AddSample(features, x > 0 ? 1.0f : 0.0f);
+  }
+
+  LogisticRegression model({0.0f, 0.0f});
+  const float first_loss = model.Train(data, 1, 1.0f);
+  const float last_loss = model.Train(data, 200, 1.0f);
+  EXPECT_LT(last_loss, first_loss);
+  EXPECT_GT(model.weights()[1], 0.0f);
+
+  const std::vector<float> predictions = model.Predict(data);
+  for (size_t i = 0; i < data.sample_count(); ++i) {
+    EXPECT_EQ(data.labels()[i] > 0.5f, predictions[i] > 0.5f);
+  }
+}
+
+}  // namespace brave_federated
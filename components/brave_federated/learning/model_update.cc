@@ -0,0 +1,17 @@
+/* Copyright (c) 2022 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/brave_federated/learning/model_update.h"
+
+namespace brave_federated {
+
+ModelUpdate::ModelUpdate() = default;
+ModelUpdate::ModelUpdate(const ModelUpdate& other) = default;
+ModelUpdate::ModelUpdate(ModelUpdate&& other) = default;
+ModelUpdate& ModelUpdate::operator=(const ModelUpdate& other) = default;
+ModelUpdate& ModelUpdate::operator=(ModelUpdate&& other) = default;
+ModelUpdate::~ModelUpdate() = default;
+
+}  // namespace brave_federated
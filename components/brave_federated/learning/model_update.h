@@ -0,0 +1,45 @@
+/* Copyright (c) 2022 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#ifndef BRAVE_COMPONENTS_BRAVE_FEDERATED_LEARNING_MODEL_UPDATE_H_
+#define BRAVE_COMPONENTS_BRAVE_FEDERATED_LEARNING_MODEL_UPDATE_H_
+
+#include <string>
+#include <vector>
+
+#include "base/callback.h"
+
+namespace brave_federated {
+
+// Result of a local training round. Only the change to the model weights
+// leaves the device, never the logs it was trained on.
+struct ModelUpdate {
+  ModelUpdate();
+  ModelUpdate(const ModelUpdate& other);
+  ModelUpdate(ModelUpdate&& other);
+  ModelUpdate& operator=(const ModelUpdate& other);
+  ModelUpdate& operator=(ModelUpdate&& other);
+  ~ModelUpdate();
+
+  std::string task_name;
+  std::vector<float> weight_deltas;
+  size_t sample_count = 0;
+  float loss = 0.0f;
+};
+
+// Receives model updates produced on the device, e.g. to combine them with
+// the updates of other clients. Implementations decide how updates are
+// transported; the training engine does not depend on any of them.
+class Aggregator {
+ public:
+  virtual ~Aggregator() = default;
+
+  virtual void SubmitModelUpdate(const ModelUpdate& update,
+                                 base::OnceCallback<void(bool)> callback) = 0;
+};
+
+}  // namespace brave_federated
+
+#endif  // BRAVE_COMPONENTS_BRAVE_FEDERATED_LEARNING_MODEL_UPDATE_H_
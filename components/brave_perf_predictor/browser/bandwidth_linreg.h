@@ -10,6 +10,7 @@
 #include <vector>
 
 #include "base/containers/flat_map.h"
+#include "base/strings/string_piece.h"
 #include "brave/components/brave_perf_predictor/browser/bandwidth_linreg_parameters.h"
 
 namespace brave_perf_predictor {
@@ -18,6 +19,17 @@ constexpr double kOutlierThreshold = 6;
 // if above 20MB _and_ more than 6x of the transfer size, probably an outlier
 constexpr double kSavingsAbsoluteOutlier = 20 << 20;
 
+// Returns the index of the standardised feature |name| in the feature vector,
+// or |feature_count| if there is no such feature. Meant to be used in
+// constant expressions, so that feature layouts are resolved at build time.
+constexpr size_t StandardisedFeatureIndex(base::StringPiece name) {
+  for (size_t i = 0; i < standardise_feat_names.size(); i++) {
+    if (standardise_feat_names[i] == name)
+      return i;
+  }
+  return feature_count;
+}
+
 // Computes prediction based on the provided feature vector.
 // It is the client's responsibility to provide features in
 // the exact order expected by the predictor.
@@ -13,6 +13,7 @@
 
 #include "base/containers/flat_set.h"
 #include "base/containers/flat_map.h"
+#include "base/strings/string_piece.h"
 
 namespace brave_perf_predictor {
 
@@ -288,6 +289,40 @@ constexpr std::array<double, standardise_feat_count> standardise_feat_scale = {
 3333644.900695055
 };
 
+// Names of the standardised features, which lead |feature_sequence|. Usable in
+// constant expressions so that callers can resolve feature indices at build
+// time.
+constexpr std::array<base::StringPiece, standardise_feat_count> standardise_feat_names = {
+    "adblockRequests",
+    "metrics.firstMeaningfulPaint",
+    "metrics.observedDomContentLoaded",
+    "metrics.observedFirstVisualChange",
+    "metrics.observedLoad",
+    "resources.document.requestCount",
+    "resources.document.size",
+    "resources.font.requestCount",
+    "resources.font.size",
+    "resources.image.requestCount",
+    "resources.image.size",
+    "resources.media.requestCount",
+    "resources.media.size",
+    "resources.other.requestCount",
+    "resources.other.size",
+    "resources.script.requestCount",
+    "resources.script.size",
+    "resources.stylesheet.requestCount",
+    "resources.stylesheet.size",
+    "resources.third-party.requestCount",
+    "resources.third-party.size",
+    "resources.total.requestCount",
+    "resources.total.size",
+};
+
+// Index of the first "thirdParties.<entity>.blocked" feature in
+// |feature_sequence|. Those features follow |relevant_entities| order, so the
+// feature for relevant_entities[i] is at third_party_feature_offset + i.
+constexpr unsigned int third_party_feature_offset = 23;
+
 const std::array<std::string, feature_count> feature_sequence{
     "adblockRequests",
     "metrics.firstMeaningfulPaint",
@@ -16,6 +16,20 @@ TEST(BraveSavingsPredictorTest, FeatureArrayGetsPrediction) {
   EXPECT_NE(result, 0);
 }
 
+TEST(BraveSavingsPredictorTest, FeatureLayoutMatchesFeatureSequence) {
+  for (size_t i = 0; i < standardise_feat_count; i++) {
+    EXPECT_EQ(StandardisedFeatureIndex(standardise_feat_names[i]), i);
+    EXPECT_EQ(feature_sequence[i], standardise_feat_names[i]);
+  }
+  EXPECT_EQ(StandardisedFeatureIndex("transfer.total.size"),
+            static_cast<size_t>(feature_count));
+
+  for (size_t i = 0; i < relevant_entities.size(); i++) {
+    EXPECT_EQ(feature_sequence[third_party_feature_offset + i],
+              "thirdParties." + relevant_entities[i] + ".blocked");
+  }
+}
+
 TEST(BraveSavingsPredictorTest, HandlesSpecificVectorExample) {
   // This test needs to be updated for any change in the model
   constexpr std::array<double, feature_count> sample = {
@@ -7,7 +7,10 @@
 
 #include <iostream>
 
+#include "base/containers/flat_map.h"
 #include "base/logging.h"
+#include "base/no_destructor.h"
+#include "base/strings/string_piece.h"
 #include "brave/components/brave_perf_predictor/browser/bandwidth_linreg.h"
 #include "components/page_load_metrics/common/page_load_metrics.mojom.h"
 #include "net/base/registry_controlled_domains/registry_controlled_domain.h"
@@ -15,6 +18,131 @@
 
 namespace brave_perf_predictor {
 
+namespace {
+
+// Feature indices, resolved against the generated model parameters at build
+// time so that accumulating a feature is a plain array access.
+constexpr size_t kAdblockRequests =
+    StandardisedFeatureIndex("adblockRequests");
+constexpr size_t kFirstMeaningfulPaint =
+    StandardisedFeatureIndex("metrics.firstMeaningfulPaint");
+constexpr size_t kObservedDomContentLoaded =
+    StandardisedFeatureIndex("metrics.observedDomContentLoaded");
+constexpr size_t kObservedFirstVisualChange =
+    StandardisedFeatureIndex("metrics.observedFirstVisualChange");
+constexpr size_t kObservedLoad =
+    StandardisedFeatureIndex("metrics.observedLoad");
+constexpr size_t kThirdPartyRequestCount =
+    StandardisedFeatureIndex("resources.third-party.requestCount");
+constexpr size_t kThirdPartySize =
+    StandardisedFeatureIndex("resources.third-party.size");
+constexpr size_t kTotalRequestCount =
+    StandardisedFeatureIndex("resources.total.requestCount");
+constexpr size_t kTotalSize = StandardisedFeatureIndex("resources.total.size");
+
+struct ResourceTypeFeatures {
+  size_t request_count;
+  size_t size;
+};
+
+constexpr ResourceTypeFeatures kDocumentFeatures = {
+    StandardisedFeatureIndex("resources.document.requestCount"),
+    StandardisedFeatureIndex("resources.document.size")};
+constexpr ResourceTypeFeatures kStylesheetFeatures = {
+    StandardisedFeatureIndex("resources.stylesheet.requestCount"),
+    StandardisedFeatureIndex("resources.stylesheet.size")};
+constexpr ResourceTypeFeatures kScriptFeatures = {
+    StandardisedFeatureIndex("resources.script.requestCount"),
+    StandardisedFeatureIndex("resources.script.size")};
+constexpr ResourceTypeFeatures kImageFeatures = {
+    StandardisedFeatureIndex("resources.image.requestCount"),
+    StandardisedFeatureIndex("resources.image.size")};
+constexpr ResourceTypeFeatures kFontFeatures = {
+    StandardisedFeatureIndex("resources.font.requestCount"),
+    StandardisedFeatureIndex("resources.font.size")};
+constexpr ResourceTypeFeatures kMediaFeatures = {
+    StandardisedFeatureIndex("resources.media.requestCount"),
+    StandardisedFeatureIndex("resources.media.size")};
+constexpr ResourceTypeFeatures kOtherFeatures = {
+    StandardisedFeatureIndex("resources.other.requestCount"),
+    StandardisedFeatureIndex("resources.other.size")};
+
+constexpr size_t kFeatureIndices[] = {
+    kAdblockRequests,
+    kFirstMeaningfulPaint,
+    kObservedDomContentLoaded,
+    kObservedFirstVisualChange,
+    kObservedLoad,
+    kThirdPartyRequestCount,
+    kThirdPartySize,
+    kTotalRequestCount,
+    kTotalSize,
+    kDocumentFeatures.request_count,
+    kDocumentFeatures.size,
+    kStylesheetFeatures.request_count,
+    kStylesheetFeatures.size,
+    kScriptFeatures.request_count,
+    kScriptFeatures.size,
+    kImageFeatures.request_count,
+    kImageFeatures.size,
+    kFontFeatures.request_count,
+    kFontFeatures.size,
+    kMediaFeatures.request_count,
+    kMediaFeatures.size,
+    kOtherFeatures.request_count,
+    kOtherFeatures.size,
+};
+
+constexpr bool AllFeatureIndicesValid() {
+  for (size_t index : kFeatureIndices) {
+    if (index >= feature_count)
+      return false;
+  }
+  return true;
+}
+
+static_assert(AllFeatureIndicesValid(),
+              "A feature used by the predictor is missing from the model "
+              "parameters");
+
+const ResourceTypeFeatures& GetResourceTypeFeatures(
+    network::mojom::RequestDestination destination) {
+  switch (destination) {
+    case network::mojom::RequestDestination::kDocument:
+    case network::mojom::RequestDestination::kIframe:
+      return kDocumentFeatures;
+    case network::mojom::RequestDestination::kStyle:
+      return kStylesheetFeatures;
+    case network::mojom::RequestDestination::kScript:
+      return kScriptFeatures;
+    case network::mojom::RequestDestination::kImage:
+      return kImageFeatures;
+    case network::mojom::RequestDestination::kFont:
+      return kFontFeatures;
+    case network::mojom::RequestDestination::kAudio:
+    case network::mojom::RequestDestination::kTrack:
+    case network::mojom::RequestDestination::kVideo:
+      return kMediaFeatures;
+    default:
+      return kOtherFeatures;
+  }
+}
+
+// Maps a relevant third party entity name to its "thirdParties.*.blocked"
+// feature index.
+const base::flat_map<base::StringPiece, size_t>& GetThirdPartyFeatureIndices() {
+  static const base::NoDestructor<base::flat_map<base::StringPiece, size_t>>
+      indices([] {
+        base::flat_map<base::StringPiece, size_t> indices;
+        for (size_t i = 0; i < relevant_entities.size(); i++)
+          indices[relevant_entities[i]] = third_party_feature_offset + i;
+        return indices;
+      }());
+  return *indices;
+}
+
+}  // namespace
+
 BandwidthSavingsPredictor::BandwidthSavingsPredictor(
     const NamedThirdPartyRegistry* registry)
     : tp_registry_(registry) {}
@@ -25,34 +153,39 @@ void BandwidthSavingsPredictor::OnPageLoadTimingUpdated(
     const page_load_metrics::mojom::PageLoadTiming& timing) {
   // First meaningful paint
   if (timing.paint_timing->first_meaningful_paint.has_value())
-    feature_map_["metrics.firstMeaningfulPaint"] =
+    features_[kFirstMeaningfulPaint] =
         timing.paint_timing->first_meaningful_paint.value().InMillisecondsF();
 
   // DOM Content Loaded
   if (timing.document_timing->dom_content_loaded_event_start.has_value())
-    feature_map_["metrics.observedDomContentLoaded"] =
+    features_[kObservedDomContentLoaded] =
         timing.document_timing->dom_content_loaded_event_start.value()
             .InMillisecondsF();
 
   // First contentful paint
   if (timing.paint_timing->first_contentful_paint.has_value())
-    feature_map_["metrics.observedFirstVisualChange"] =
+    features_[kObservedFirstVisualChange] =
         timing.paint_timing->first_contentful_paint.value().InMillisecondsF();
 
   // Load
   if (timing.document_timing->load_event_start.has_value())
-    feature_map_["metrics.observedLoad"] =
+    features_[kObservedLoad] =
         timing.document_timing->load_event_start.value().InMillisecondsF();
 }
 
 void BandwidthSavingsPredictor::OnSubresourceBlocked(
     const std::string& resource_url) {
-  feature_map_["adblockRequests"] += 1;
+  features_[kAdblockRequests] += 1;
 
   if (tp_registry_) {
     const auto tp_name = tp_registry_->GetThirdParty(resource_url);
-    if (tp_name.has_value())
-      feature_map_["thirdParties." + tp_name.value() + ".blocked"] = 1;
+    if (tp_name.has_value()) {
+      const auto& tp_indices = GetThirdPartyFeatureIndices();
+      const auto tp_index = tp_indices.find(tp_name.value());
+      // Third parties the model doesn't know about don't affect predictions.
+      if (tp_index != tp_indices.end())
+        features_[tp_index->second] = 1;
+    }
   }
 }
 
@@ -65,7 +198,8 @@ void BandwidthSavingsPredictor::OnResourceLoadComplete(
       !main_frame_url.SchemeIsHTTPOrHTTPS()) {
     return;
   }
-  main_frame_url_ = main_frame_url;
+  if (main_frame_url_ != main_frame_url)
+    main_frame_url_ = main_frame_url;
 
   const bool is_third_party =
       !net::registry_controlled_domains::SameDomainOrHost(
@@ -73,47 +207,18 @@ void BandwidthSavingsPredictor::OnResourceLoadComplete(
           net::registry_controlled_domains::INCLUDE_PRIVATE_REGISTRIES);
 
   if (is_third_party) {
-    feature_map_["resources.third-party.requestCount"] += 1;
-    feature_map_["resources.third-party.size"] +=
-        resource_load_info.raw_body_bytes;
+    features_[kThirdPartyRequestCount] += 1;
+    features_[kThirdPartySize] += resource_load_info.raw_body_bytes;
   }
 
-  feature_map_["resources.total.requestCount"] += 1;
-  feature_map_["resources.total.size"] += resource_load_info.raw_body_bytes;
-  feature_map_["transfer.total.size"] +=
-      resource_load_info.total_received_bytes;
-  std::string resource_type;
-  switch (resource_load_info.request_destination) {
-    case network::mojom::RequestDestination::kDocument:
-      resource_type = "document";
-      break;
-    case network::mojom::RequestDestination::kIframe:
-      resource_type = "document";
-      break;
-    case network::mojom::RequestDestination::kStyle:
-      resource_type = "stylesheet";
-      break;
-    case network::mojom::RequestDestination::kScript:
-      resource_type = "script";
-      break;
-    case network::mojom::RequestDestination::kImage:
-      resource_type = "image";
-      break;
-    case network::mojom::RequestDestination::kFont:
-      resource_type = "font";
-      break;
-    case network::mojom::RequestDestination::kAudio:
-    case network::mojom::RequestDestination::kTrack:
-    case network::mojom::RequestDestination::kVideo:
-      resource_type = "media";
-      break;
-    default:
-      resource_type = "other";
-      break;
-  }
-  feature_map_["resources." + resource_type + ".requestCount"] += 1;
-  feature_map_["resources." + resource_type + ".size"] +=
-      resource_load_info.raw_body_bytes;
+  features_[kTotalRequestCount] += 1;
+  features_[kTotalSize] += resource_load_info.raw_body_bytes;
+  transfer_total_size_ += resource_load_info.total_received_bytes;
+
+  const ResourceTypeFeatures& resource_type =
+      GetResourceTypeFeatures(resource_load_info.request_destination);
+  features_[resource_type.request_count] += 1;
+  features_[resource_type.size] += resource_load_info.raw_body_bytes;
 }
 
 double BandwidthSavingsPredictor::PredictSavingsBytes() const {
@@ -121,37 +226,37 @@ double BandwidthSavingsPredictor::PredictSavingsBytes() const {
       !main_frame_url_.SchemeIsHTTPOrHTTPS()) {
     return 0;
   }
-  const auto total_size = feature_map_.find("transfer.total.size");
-  if (total_size != feature_map_.end() && total_size->second > 0) {
-    VLOG(2) << main_frame_url_ << " total download size " << total_size->second
-            << " bytes";
+  if (transfer_total_size_ > 0) {
+    VLOG(2) << main_frame_url_ << " total download size "
+            << transfer_total_size_ << " bytes";
   } else {
     return 0;
   }
 
   // Short-circuit if nothing got blocked
-  const auto adblock_requests = feature_map_.find("adblockRequests");
-  if (adblock_requests == feature_map_.end() || adblock_requests->second < 1) {
+  if (features_[kAdblockRequests] < 1) {
     return 0;
   }
   if (VLOG_IS_ON(3)) {
-    VLOG(3) << "Predicting on feature map:";
-    for (const auto& feature : feature_map_) {
-      VLOG(3) << feature.first << " :: " << feature.second;
+    VLOG(3) << "Predicting on features:";
+    for (size_t i = 0; i < features_.size(); i++) {
+      if (features_[i] != 0)
+        VLOG(3) << feature_sequence[i] << " :: " << features_[i];
     }
   }
-  double prediction = ::brave_perf_predictor::LinregPredictNamed(feature_map_);
+  double prediction = ::brave_perf_predictor::LinregPredictVector(features_);
   VLOG(2) << main_frame_url_ << " estimated saving " << prediction << " bytes";
   // Sanity check for predicted saving
   if (prediction > kSavingsAbsoluteOutlier &&
-      (prediction / kOutlierThreshold) > total_size->second) {
+      (prediction / kOutlierThreshold) > transfer_total_size_) {
     return 0;
   }
   return prediction;
 }
 
 void BandwidthSavingsPredictor::Reset() {
-  feature_map_.clear();
+  features_.fill(0);
+  transfer_total_size_ = 0;
   main_frame_url_ = {};
 }
 
@@ -7,12 +7,11 @@
 #define BRAVE_COMPONENTS_BRAVE_PERF_PREDICTOR_BROWSER_NAMED_THIRD_PARTY_REGISTRY_H_
 
 #include <string>
-#include <tuple>
 
-#include "base/containers/flat_map.h"
-#include "base/memory/weak_ptr.h"
-#include "base/values.h"
+#include "base/strings/string_piece.h"
+#include "brave/components/brave_perf_predictor/browser/third_party_entity_index.h"
 #include "components/keyed_service/core/keyed_service.h"
+#include "third_party/abseil-cpp/absl/types/optional.h"
 
 namespace brave_perf_predictor {
 
@@ -31,23 +30,19 @@ class NamedThirdPartyRegistry : public KeyedService {
   // entities not relevant to the bandwith prediction model (i.e. those not
   // seen in training the model).
   bool LoadMappings(const base::StringPiece entities, bool discard_irrelevant);
-  // Default initialization - asynchronously load from bundled resource
+  // Default initialization - use the entity index prebuilt at build time from
+  // the bundled mappings, in place.
   void InitializeDefault();
-  absl::optional<std::string> GetThirdParty(
+  // The returned name stays valid until mappings are reloaded.
+  absl::optional<base::StringPiece> GetThirdParty(
       const base::StringPiece domain) const;
 
  private:
-  bool IsInitialized() const { return initialized_; }
-  void MarkInitialized(bool initialized) { initialized_ = initialized; }
-  void UpdateMappings(
-      std::tuple<base::flat_map<std::string, std::string>,
-                 base::flat_map<std::string, std::string>> entity_mappings);
+  bool IsInitialized() const { return index_.is_valid(); }
 
-  bool initialized_ = false;
-  base::flat_map<std::string, std::string> entity_by_domain_;
-  base::flat_map<std::string, std::string> entity_by_root_domain_;
-
-  base::WeakPtrFactory<NamedThirdPartyRegistry> weak_factory_{this};
+  // Backs |index_| when the mappings were loaded from JSON.
+  std::string index_data_;
+  ThirdPartyEntityIndex index_;
 };
 
 }  // namespace brave_perf_predictor
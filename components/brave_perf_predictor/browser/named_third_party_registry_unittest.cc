@@ -111,6 +111,31 @@ TEST(NamedThirdPartyRegistryTest, ExtractsThirdPartyRootDomainTest) {
   EXPECT_EQ(entity.value(), "Facebook");
 }
 
+TEST(NamedThirdPartyRegistryTest, MatchesOnlyRootDomainAndSubdomains) {
+  NamedThirdPartyRegistry* extractor = new NamedThirdPartyRegistry();
+  extractor->LoadMappings(test_mapping, false);
+
+  auto entity = extractor->GetThirdParty("https://www.urchin.com/x.js");
+  ASSERT_TRUE(entity.has_value());
+  EXPECT_EQ(entity.value(), "Google Analytics");
+  EXPECT_FALSE(extractor->GetThirdParty("https://xurchin.com").has_value());
+  EXPECT_FALSE(extractor->GetThirdParty("https://urchin.co").has_value());
+}
+
+TEST(NamedThirdPartyRegistryTest, IgnoresRootDomainClash) {
+  NamedThirdPartyRegistry* extractor = new NamedThirdPartyRegistry();
+  extractor->LoadMappings(R"([
+    {"name": "First", "domains": ["a.example.com"]},
+    {"name": "Second", "domains": ["b.example.com"]}
+  ])",
+                          false);
+
+  auto entity = extractor->GetThirdParty("https://a.example.com");
+  ASSERT_TRUE(entity.has_value());
+  EXPECT_EQ(entity.value(), "First");
+  EXPECT_FALSE(extractor->GetThirdParty("https://c.example.com").has_value());
+}
+
 TEST(NamedThirdPartyRegistryTest, HandlesUnrecognisedThirdPartyTest) {
   NamedThirdPartyRegistry* extractor = new NamedThirdPartyRegistry();
   auto dataset = LoadFile();
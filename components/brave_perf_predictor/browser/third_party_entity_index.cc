@@ -0,0 +1,257 @@
+/* Copyright (c) 2022 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/brave_perf_predictor/browser/third_party_entity_index.h"
+
+#include <string.h>
+
+#include <algorithm>
+#include <map>
+#include <utility>
+#include <vector>
+
+#include "base/containers/flat_map.h"
+#include "base/json/json_reader.h"
+#include "base/logging.h"
+#include "base/values.h"
+#include "build/build_config.h"
+
+namespace brave_perf_predictor {
+
+namespace {
+
+static_assert(ARCH_CPU_LITTLE_ENDIAN,
+              "The third party entity index is stored little-endian");
+
+constexpr size_t kHeaderSize = 4 * sizeof(uint32_t);
+constexpr size_t kEntityRecordSize = 2 * sizeof(uint32_t);
+constexpr size_t kDomainRecordSize = 3 * sizeof(uint32_t);
+
+uint32_t ReadUint32(base::StringPiece data, size_t offset) {
+  uint32_t value;
+  memcpy(&value, data.data() + offset, sizeof(value));
+  return value;
+}
+
+void AppendUint32(std::string* out, uint32_t value) {
+  out->append(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+// Compares |stored|, a reversed domain from the index, against the reverse of
+// |domain| without materializing the latter.
+int CompareReversed(base::StringPiece stored, base::StringPiece domain) {
+  const size_t length = std::min(stored.size(), domain.size());
+  for (size_t i = 0; i < length; i++) {
+    const unsigned char a = stored[i];
+    const unsigned char b = domain[domain.size() - 1 - i];
+    if (a != b)
+      return a < b ? -1 : 1;
+  }
+  if (stored.size() == domain.size())
+    return 0;
+  return stored.size() < domain.size() ? -1 : 1;
+}
+
+}  // namespace
+
+ThirdPartyEntityIndex::ThirdPartyEntityIndex() = default;
+
+ThirdPartyEntityIndex::ThirdPartyEntityIndex(base::StringPiece data) {
+  if (data.size() < kHeaderSize || ReadUint32(data, 0) != kMagic ||
+      ReadUint32(data, 4) != kVersion) {
+    LOG(ERROR) << "Malformed third party entity index";
+    return;
+  }
+  const uint64_t entity_count = ReadUint32(data, 8);
+  const uint64_t domain_count = ReadUint32(data, 12);
+  const uint64_t strings_offset = kHeaderSize +
+                                  entity_count * kEntityRecordSize +
+                                  domain_count * kDomainRecordSize;
+  if (strings_offset > data.size()) {
+    LOG(ERROR) << "Truncated third party entity index";
+    return;
+  }
+
+  // Everything fits in |data| from here on. Validate every record once up
+  // front, so that lookups can trust them.
+  const size_t strings_size = data.size() - strings_offset;
+  for (size_t i = 0; i < entity_count; i++) {
+    const size_t record = kHeaderSize + i * kEntityRecordSize;
+    const uint64_t offset = ReadUint32(data, record);
+    const uint64_t length = ReadUint32(data, record + 4);
+    if (offset + length > strings_size) {
+      LOG(ERROR) << "Malformed third party entity index entity " << i;
+      return;
+    }
+  }
+  const size_t domains_offset = kHeaderSize + entity_count * kEntityRecordSize;
+  for (size_t i = 0; i < domain_count; i++) {
+    const size_t record = domains_offset + i * kDomainRecordSize;
+    const uint64_t offset = ReadUint32(data, record);
+    const uint64_t length = ReadUint32(data, record + 4);
+    if (offset + length > strings_size ||
+        ReadUint32(data, record + 8) >= entity_count) {
+      LOG(ERROR) << "Malformed third party entity index domain " << i;
+      return;
+    }
+  }
+
+  data_ = data;
+  strings_offset_ = static_cast<size_t>(strings_offset);
+  entity_count_ = static_cast<size_t>(entity_count);
+  domain_count_ = static_cast<size_t>(domain_count);
+}
+
+ThirdPartyEntityIndex::ThirdPartyEntityIndex(const ThirdPartyEntityIndex&) =
+    default;
+
+ThirdPartyEntityIndex& ThirdPartyEntityIndex::operator=(
+    const ThirdPartyEntityIndex&) = default;
+
+ThirdPartyEntityIndex::~ThirdPartyEntityIndex() = default;
+
+// static
+std::string ThirdPartyEntityIndex::BuildFromJSON(
+    base::StringPiece entities,
+    const base::flat_set<std::string>* relevant_entities) {
+  absl::optional<base::Value> document = base::JSONReader::Read(entities);
+  if (!document || !document->is_list()) {
+    LOG(ERROR) << "Cannot parse the third-party entities list";
+    return std::string();
+  }
+
+  std::vector<std::string> entity_names;
+  base::flat_map<std::string, uint32_t> entity_indices;
+  // Reversed domain to entity index, in the order the index stores them.
+  std::map<std::string, uint32_t> domains;
+  for (const auto& entity : document->GetList()) {
+    const std::string* entity_name = entity.FindStringPath("name");
+    if (!entity_name)
+      continue;
+    if (relevant_entities && !relevant_entities->contains(*entity_name)) {
+      VLOG(3) << "Irrelevant entity " << *entity_name;
+      continue;
+    }
+    const auto* entity_domains = entity.FindListPath("domains");
+    if (!entity_domains)
+      continue;
+
+    const auto entity_index =
+        entity_indices.emplace(*entity_name, entity_names.size());
+    if (entity_index.second)
+      entity_names.push_back(*entity_name);
+
+    for (const auto& entity_domain : entity_domains->GetList()) {
+      if (!entity_domain.is_string())
+        continue;
+      std::string reversed_domain(entity_domain.GetString().rbegin(),
+                                  entity_domain.GetString().rend());
+      const auto inserted = domains.emplace(std::move(reversed_domain),
+                                            entity_index.first->second);
+      if (!inserted.second) {
+        VLOG(2) << "Malformed data: duplicate domain "
+                << entity_domain.GetString();
+      }
+    }
+  }
+
+  std::string index;
+  AppendUint32(&index, kMagic);
+  AppendUint32(&index, kVersion);
+  AppendUint32(&index, entity_names.size());
+  AppendUint32(&index, domains.size());
+
+  uint32_t offset = 0;
+  for (const auto& entity_name : entity_names) {
+    AppendUint32(&index, offset);
+    AppendUint32(&index, entity_name.size());
+    offset += entity_name.size();
+  }
+  for (const auto& domain : domains) {
+    AppendUint32(&index, offset);
+    AppendUint32(&index, domain.first.size());
+    AppendUint32(&index, domain.second);
+    offset += domain.first.size();
+  }
+  for (const auto& entity_name : entity_names)
+    index.append(entity_name);
+  for (const auto& domain : domains)
+    index.append(domain.first);
+  return index;
+}
+
+absl::optional<base::StringPiece> ThirdPartyEntityIndex::FindByDomain(
+    base::StringPiece domain) const {
+  const size_t index = LowerBound(domain);
+  if (index == domain_count_ || CompareReversed(GetDomain(index), domain) != 0)
+    return absl::nullopt;
+  return GetEntityName(GetDomainEntity(index));
+}
+
+absl::optional<base::StringPiece> ThirdPartyEntityIndex::FindByRootDomain(
+    base::StringPiece root_domain) const {
+  if (root_domain.empty())
+    return absl::nullopt;
+
+  absl::optional<uint32_t> entity;
+  for (size_t index = LowerBound(root_domain); index < domain_count_;
+       index++) {
+    const base::StringPiece domain = GetDomain(index);
+    // The range of domains sharing the reversed |root_domain| prefix also
+    // holds unrelated ones such as "xexample.com" for "example.com", which
+    // are skipped: only the root domain itself and its subdomains count.
+    if (domain.size() < root_domain.size() ||
+        CompareReversed(domain.substr(0, root_domain.size()), root_domain) !=
+            0) {
+      break;
+    }
+    if (domain.size() > root_domain.size() && domain[root_domain.size()] != '.')
+      continue;
+
+    const uint32_t domain_entity = GetDomainEntity(index);
+    if (entity && *entity != domain_entity)
+      return absl::nullopt;
+    entity = domain_entity;
+  }
+
+  if (!entity)
+    return absl::nullopt;
+  return GetEntityName(*entity);
+}
+
+base::StringPiece ThirdPartyEntityIndex::GetDomain(size_t index) const {
+  const size_t record = kHeaderSize + entity_count_ * kEntityRecordSize +
+                        index * kDomainRecordSize;
+  return data_.substr(strings_offset_ + ReadUint32(data_, record),
+                      ReadUint32(data_, record + 4));
+}
+
+base::StringPiece ThirdPartyEntityIndex::GetEntityName(size_t index) const {
+  const size_t record = kHeaderSize + index * kEntityRecordSize;
+  return data_.substr(strings_offset_ + ReadUint32(data_, record),
+                      ReadUint32(data_, record + 4));
+}
+
+uint32_t ThirdPartyEntityIndex::GetDomainEntity(size_t index) const {
+  const size_t record = kHeaderSize + entity_count_ * kEntityRecordSize +
+                        index * kDomainRecordSize;
+  return ReadUint32(data_, record + 8);
+}
+
+size_t ThirdPartyEntityIndex::LowerBound(base::StringPiece domain) const {
+  size_t low = 0;
+  size_t high = domain_count_;
+  while (low < high) {
+    const size_t middle = low + (high - low) / 2;
+    if (CompareReversed(GetDomain(middle), domain) < 0) {
+      low = middle + 1;
+    } else {
+      high = middle;
+    }
+  }
+  return low;
+}
+
+}  // namespace brave_perf_predictor
@@ -0,0 +1,77 @@
+/* Copyright (c) 2022 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#ifndef BRAVE_COMPONENTS_BRAVE_PERF_PREDICTOR_BROWSER_THIRD_PARTY_ENTITY_INDEX_H_
+#define BRAVE_COMPONENTS_BRAVE_PERF_PREDICTOR_BROWSER_THIRD_PARTY_ENTITY_INDEX_H_
+
+#include <stdint.h>
+
+#include <string>
+
+#include "base/containers/flat_set.h"
+#include "base/strings/string_piece.h"
+#include "third_party/abseil-cpp/absl/types/optional.h"
+
+namespace brave_perf_predictor {
+
+// Read-only view over a binary third party entity index, as produced by
+// resources/generate_third_party_entities.py at build time. The index is
+// searched in place, so it can point straight into the resource bundle.
+//
+// Layout (all integers are little-endian uint32):
+//   header:   magic, version, entity count, domain count
+//   entities: entity count x (name offset, name length)
+//   domains:  domain count x (offset, length, entity index)
+//   strings:  entity names, each stored once, followed by the domains
+// Domains are stored with their characters reversed and sorted bytewise, so
+// that a domain and all of its subdomains form a contiguous range.
+class ThirdPartyEntityIndex {
+ public:
+  static constexpr uint32_t kMagic = 0x49455054;  // "TPEI"
+  static constexpr uint32_t kVersion = 1;
+
+  ThirdPartyEntityIndex();
+  // |data| must outlive this object. If |data| isn't a well-formed index the
+  // result is invalid and finds nothing.
+  explicit ThirdPartyEntityIndex(base::StringPiece data);
+  ThirdPartyEntityIndex(const ThirdPartyEntityIndex&);
+  ThirdPartyEntityIndex& operator=(const ThirdPartyEntityIndex&);
+  ~ThirdPartyEntityIndex();
+
+  // Builds an index in the same format from the Third Party Web JSON entities
+  // list. If |relevant_entities| is not null, other entities are skipped.
+  // Returns an empty string if |entities| can't be parsed.
+  static std::string BuildFromJSON(
+      base::StringPiece entities,
+      const base::flat_set<std::string>* relevant_entities);
+
+  bool is_valid() const { return domain_count_ > 0; }
+  size_t domain_count() const { return domain_count_; }
+
+  // Returns the entity that lists exactly |domain|.
+  absl::optional<base::StringPiece> FindByDomain(
+      base::StringPiece domain) const;
+  // Returns the entity owning |root_domain| or any of its subdomains, unless
+  // several entities do, in which case neither is considered correct.
+  absl::optional<base::StringPiece> FindByRootDomain(
+      base::StringPiece root_domain) const;
+
+ private:
+  base::StringPiece GetDomain(size_t index) const;
+  base::StringPiece GetEntityName(size_t index) const;
+  uint32_t GetDomainEntity(size_t index) const;
+  // Returns the index of the first domain not less than the reverse of
+  // |domain|.
+  size_t LowerBound(base::StringPiece domain) const;
+
+  base::StringPiece data_;
+  size_t strings_offset_ = 0;
+  size_t entity_count_ = 0;
+  size_t domain_count_ = 0;
+};
+
+}  // namespace brave_perf_predictor
+
+#endif  // BRAVE_COMPONENTS_BRAVE_PERF_PREDICTOR_BROWSER_THIRD_PARTY_ENTITY_INDEX_H_
@@ -13,6 +13,7 @@
 
 #include "base/containers/flat_set.h"
 #include "base/containers/flat_map.h"
+#include "base/strings/string_piece.h"
 
 namespace brave_perf_predictor {
 
@@ -32,6 +33,20 @@ constexpr std::array<double, standardise_feat_count> standardise_feat_scale = {
 {{transformers.standardise.scale | join(',\n')}}
 };
 
+// Names of the standardised features, which lead |feature_sequence|. Usable in
+// constant expressions so that callers can resolve feature indices at build
+// time.
+constexpr std::array<base::StringPiece, standardise_feat_count> standardise_feat_names = {
+{% for feature in transformers.standardise.features %}
+    "{{feature}}",
+{% endfor %}
+};
+
+// Index of the first "thirdParties.<entity>.blocked" feature in
+// |feature_sequence|. Those features follow |relevant_entities| order, so the
+// feature for relevant_entities[i] is at third_party_feature_offset + i.
+constexpr unsigned int third_party_feature_offset = {{model.coefficients | length - misc.entities | length}};
+
 const std::array<std::string, feature_count> feature_sequence{
     {% for feature in transformers.standardise.features %}
     "{{feature}}",
@@ -0,0 +1,91 @@
+#!/usr/bin/env python
+#
+# Copyright (c) 2022 The Brave Authors. All rights reserved.
+# This Source Code Form is subject to the terms of the Mozilla Public
+# License, v. 2.0. If a copy of the MPL was not distributed with this file,
+# You can obtain one at https://mozilla.org/MPL/2.0/.
+
+"""
+Converts the Third Party Web entities list into the binary index read in place
+by brave_perf_predictor::ThirdPartyEntityIndex. Only entities relevant to the
+bandwidth prediction model are kept.
+
+Usage:
+    generate_third_party_entities.py --entities entities.json \
+        --parameters bandwidth_linreg_parameters.h --output entities.bin
+"""
+
+import argparse
+import json
+import re
+import struct
+import sys
+
+# Keep in sync with third_party_entity_index.h.
+MAGIC = 0x49455054
+VERSION = 1
+
+
+def read_relevant_entities(parameters_path):
+    with open(parameters_path, 'r', encoding='utf-8') as parameters_file:
+        parameters = parameters_file.read()
+    match = re.search(r'relevant_entities\{(.*?)\};', parameters, re.DOTALL)
+    if not match:
+        raise Exception('relevant_entities not found in ' + parameters_path)
+    return set(re.findall(r'"((?:[^"\\]|\\.)*)"', match.group(1)))
+
+
+def build_index(entities, relevant_entities):
+    entity_names = []
+    entity_indices = {}
+    # Reversed domain to entity index; the first entity listing a domain wins.
+    domains = {}
+    for entity in entities:
+        name = entity.get('name')
+        if not isinstance(name, str) or name not in relevant_entities:
+            continue
+        entity_domains = entity.get('domains')
+        if not isinstance(entity_domains, list):
+            continue
+        if name not in entity_indices:
+            entity_indices[name] = len(entity_names)
+            entity_names.append(name.encode('utf-8'))
+        for domain in entity_domains:
+            if not isinstance(domain, str):
+                continue
+            domains.setdefault(domain.encode('utf-8')[::-1],
+                               entity_indices[name])
+
+    sorted_domains = sorted(domains.items())
+    header = struct.pack('<4I', MAGIC, VERSION, len(entity_names),
+                         len(sorted_domains))
+    records = []
+    offset = 0
+    for name in entity_names:
+        records.append(struct.pack('<2I', offset, len(name)))
+        offset += len(name)
+    for domain, entity_index in sorted_domains:
+        records.append(struct.pack('<3I', offset, len(domain), entity_index))
+        offset += len(domain)
+    strings = entity_names + [domain for domain, _ in sorted_domains]
+    return header + b''.join(records) + b''.join(strings)
+
+
+def main(args):
+    parser = argparse.ArgumentParser()
+    parser.add_argument('--entities', required=True)
+    parser.add_argument('--parameters', required=True)
+    parser.add_argument('--output', required=True)
+    options = parser.parse_args(args)
+
+    with open(options.entities, 'r', encoding='utf-8') as entities_file:
+        entities = json.load(entities_file)
+    index = build_index(entities,
+                        read_relevant_entities(options.parameters))
+    with open(options.output, 'wb') as output_file:
+        output_file.write(index)
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main(sys.argv[1:]))
@@ -34,25 +34,24 @@ bool AdBlockCustomFiltersProvider::UpdateCustomFilters(
     return false;
   local_state_->SetString(prefs::kAdBlockCustomFilters, custom_filters);
 
-  auto buffer =
-      std::vector<unsigned char>(custom_filters.begin(), custom_filters.end());
-  OnDATLoaded(false, buffer);
+  OnDATLoaded(false, DATFileData::FromBuffer(DATFileDataBuffer(
+                         custom_filters.begin(), custom_filters.end())));
 
   return true;
 }
 
 void AdBlockCustomFiltersProvider::LoadDATBuffer(
-    base::OnceCallback<void(bool deserialize, const DATFileDataBuffer& dat_buf)>
-        cb) {
+    base::OnceCallback<void(bool deserialize,
+                            scoped_refptr<DATFileData> dat_data)> cb) {
   DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
   auto custom_filters = GetCustomFilters();
 
-  auto buffer =
-      std::vector<unsigned char>(custom_filters.begin(), custom_filters.end());
+  auto dat_data = DATFileData::FromBuffer(
+      DATFileDataBuffer(custom_filters.begin(), custom_filters.end()));
 
   // PostTask so this has an async return to match other loaders
   base::ThreadTaskRunnerHandle::Get()->PostTask(
-      FROM_HERE, base::BindOnce(std::move(cb), false, std::move(buffer)));
+      FROM_HERE, base::BindOnce(std::move(cb), false, std::move(dat_data)));
 }
 
 }  // namespace brave_shields
@@ -13,6 +13,7 @@
 #include "brave/components/brave_component_updater/browser/dat_file_util.h"
 #include "brave/components/brave_shields/browser/ad_block_filters_provider.h"
 
+using brave_component_updater::DATFileData;
 using brave_component_updater::DATFileDataBuffer;
 
 class PrefService;
@@ -32,7 +33,7 @@ class AdBlockCustomFiltersProvider : public AdBlockFiltersProvider {
 
   void LoadDATBuffer(
       base::OnceCallback<void(bool deserialize,
-                              const DATFileDataBuffer& dat_buf)>) override;
+                              scoped_refptr<DATFileData> dat_data)>) override;
 
  private:
   PrefService* local_state_;
@@ -8,6 +8,7 @@
 #include <memory>
 #include <string>
 #include <utility>
+#include <vector>
 
 #include "base/files/file_path.h"
 #include "base/logging.h"
@@ -41,18 +42,13 @@ void AdBlockDefaultFiltersProvider::OnComponentReady(
   // Load the DAT (as a buffer)
   base::ThreadPool::PostTaskAndReplyWithResult(
       FROM_HERE, {base::MayBlock()},
-      base::BindOnce(&brave_component_updater::ReadDATFileData,
+      base::BindOnce(&brave_component_updater::DATFileData::MapFile,
                      component_path_.AppendASCII(DAT_FILE)),
       base::BindOnce(&AdBlockDefaultFiltersProvider::OnDATLoaded,
                      weak_factory_.GetWeakPtr(), true));
 
-  // Load the resources (as a string)
-  base::ThreadPool::PostTaskAndReplyWithResult(
-      FROM_HERE, {base::MayBlock()},
-      base::BindOnce(&brave_component_updater::GetDATFileAsString,
-                     component_path_.AppendASCII(kAdBlockResourcesFilename)),
-      base::BindOnce(&AdBlockDefaultFiltersProvider::OnResourcesLoaded,
-                     weak_factory_.GetWeakPtr()));
+  // Load and parse the resources
+  LoadResourcesStore(true);
 
   // Load the regional catalog (as a string)
   base::ThreadPool::PostTaskAndReplyWithResult(
@@ -64,8 +60,8 @@ void AdBlockDefaultFiltersProvider::OnComponentReady(
 }
 
 void AdBlockDefaultFiltersProvider::LoadDATBuffer(
-    base::OnceCallback<void(bool deserialize, const DATFileDataBuffer& dat_buf)>
-        cb) {
+    base::OnceCallback<void(bool deserialize,
+                            scoped_refptr<DATFileData> dat_data)> cb) {
   if (component_path_.empty()) {
     // If the path is not ready yet, don't run the callback. An update should
     // be pushed soon.
@@ -74,25 +70,48 @@ void AdBlockDefaultFiltersProvider::LoadDATBuffer(
 
   base::ThreadPool::PostTaskAndReplyWithResult(
       FROM_HERE, {base::MayBlock()},
-      base::BindOnce(&brave_component_updater::ReadDATFileData,
+      base::BindOnce(&brave_component_updater::DATFileData::MapFile,
                      component_path_.AppendASCII(DAT_FILE)),
       base::BindOnce(std::move(cb), true));
 }
 
 void AdBlockDefaultFiltersProvider::LoadResources(
-    base::OnceCallback<void(const std::string& resources_json)> cb) {
+    base::OnceCallback<void(scoped_refptr<AdBlockResourceStore> resources)>
+        cb) {
   if (component_path_.empty()) {
     // If the path is not ready yet, run the callback with empty resources to
     // avoid blocking filter data loads.
-    std::move(cb).Run("[]");
+    std::move(cb).Run(AdBlockResourceStore::Create("[]"));
     return;
   }
 
+  // Engines asking while a parse is in flight share its result.
+  pending_resources_callbacks_.push_back(std::move(cb));
+  if (pending_resources_callbacks_.size() == 1)
+    LoadResourcesStore(false);
+}
+
+void AdBlockDefaultFiltersProvider::LoadResourcesStore(bool notify_observers) {
   base::ThreadPool::PostTaskAndReplyWithResult(
       FROM_HERE, {base::MayBlock()},
-      base::BindOnce(&brave_component_updater::GetDATFileAsString,
+      base::BindOnce(&AdBlockResourceStore::CreateFromFile,
                      component_path_.AppendASCII(kAdBlockResourcesFilename)),
-      std::move(cb));
+      base::BindOnce(&AdBlockDefaultFiltersProvider::OnResourcesStoreLoaded,
+                     weak_factory_.GetWeakPtr(), notify_observers));
+}
+
+void AdBlockDefaultFiltersProvider::OnResourcesStoreLoaded(
+    bool notify_observers,
+    scoped_refptr<AdBlockResourceStore> resources) {
+  // The store isn't kept here: each engine copies the resources, and the store
+  // is freed once the last pending engine update has applied it.
+  std::vector<base::OnceCallback<void(scoped_refptr<AdBlockResourceStore>)>>
+      callbacks;
+  callbacks.swap(pending_resources_callbacks_);
+  for (auto& callback : callbacks)
+    std::move(callback).Run(resources);
+  if (notify_observers)
+    OnResourcesLoaded(std::move(resources));
 }
 
 void AdBlockDefaultFiltersProvider::LoadRegionalCatalog(
@@ -7,6 +7,7 @@
 #define BRAVE_COMPONENTS_BRAVE_SHIELDS_BROWSER_AD_BLOCK_DEFAULT_FILTERS_PROVIDER_H_
 
 #include <string>
+#include <vector>
 
 #include "base/callback.h"
 #include "base/observer_list.h"
@@ -16,7 +17,7 @@
 #include "brave/components/brave_shields/browser/ad_block_resource_provider.h"
 #include "third_party/abseil-cpp/absl/types/optional.h"
 
-using brave_component_updater::DATFileDataBuffer;
+using brave_component_updater::DATFileData;
 
 namespace component_updater {
 class ComponentUpdateService;
@@ -43,10 +44,11 @@ class AdBlockDefaultFiltersProvider : public AdBlockFiltersProvider,
 
   void LoadDATBuffer(
       base::OnceCallback<void(bool deserialize,
-                              const DATFileDataBuffer& dat_buf)>) override;
+                              scoped_refptr<DATFileData> dat_data)>) override;
 
   void LoadResources(
-      base::OnceCallback<void(const std::string& resources_json)>) override;
+      base::OnceCallback<void(scoped_refptr<AdBlockResourceStore> resources)>)
+      override;
 
   void LoadRegionalCatalog(
       base::OnceCallback<void(const std::string& catalog_json)>) override;
@@ -54,8 +56,14 @@ class AdBlockDefaultFiltersProvider : public AdBlockFiltersProvider,
  private:
   friend class ::AdBlockServiceTest;
   void OnComponentReady(const base::FilePath&);
+  void LoadResourcesStore(bool notify_observers);
+  void OnResourcesStoreLoaded(bool notify_observers,
+                              scoped_refptr<AdBlockResourceStore> resources);
 
   base::FilePath component_path_;
+  // LoadResources() callbacks waiting for the resources being parsed.
+  std::vector<base::OnceCallback<void(scoped_refptr<AdBlockResourceStore>)>>
+      pending_resources_callbacks_;
 
   base::WeakPtrFactory<AdBlockDefaultFiltersProvider> weak_factory_{this};
 };
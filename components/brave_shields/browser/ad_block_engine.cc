@@ -165,8 +165,9 @@ void AdBlockEngine::EnableTag(const std::string& tag, bool enabled) {
   }
 }
 
-void AdBlockEngine::AddResources(const std::string& resources) {
-  ad_block_client_->addResources(resources);
+void AdBlockEngine::AddResources(
+    scoped_refptr<AdBlockResourceStore> resources) {
+  ad_block_client_->useResources(resources->resource_list());
 }
 
 bool AdBlockEngine::TagExists(const std::string& tag) {
@@ -178,35 +179,29 @@ absl::optional<base::Value> AdBlockEngine::UrlCosmeticResources(
   return base::JSONReader::Read(ad_block_client_->urlCosmeticResources(url));
 }
 
-base::Value AdBlockEngine::HiddenClassIdSelectors(
+std::vector<std::string> AdBlockEngine::HiddenClassIdSelectors(
     const std::vector<std::string>& classes,
     const std::vector<std::string>& ids,
     const std::vector<std::string>& exceptions) {
-  absl::optional<base::Value> result = base::JSONReader::Read(
-      ad_block_client_->hiddenClassIdSelectors(classes, ids, exceptions));
-
-  if (!result) {
-    return base::ListValue();
-  } else {
-    return std::move(*result);
-  }
+  return ad_block_client_->hiddenClassIdSelectorList(classes, ids, exceptions);
 }
 
 void AdBlockEngine::Load(bool deserialize,
-                         const DATFileDataBuffer& dat_buf,
-                         const std::string& resources_json) {
+                         scoped_refptr<DATFileData> dat_data,
+                         scoped_refptr<AdBlockResourceStore> resources) {
   if (deserialize) {
-    OnDATLoaded(dat_buf, resources_json);
+    OnDATLoaded(*dat_data, resources.get());
   } else {
-    OnListSourceLoaded(dat_buf, resources_json);
+    OnListSourceLoaded(*dat_data, resources.get());
   }
 }
 
 void AdBlockEngine::UpdateAdBlockClient(
     std::unique_ptr<adblock::Engine> ad_block_client,
-    const std::string& resources_json) {
+    const AdBlockResourceStore* resources) {
   ad_block_client_ = std::move(ad_block_client);
-  AddResources(resources_json);
+  if (resources)
+    ad_block_client_->useResources(resources->resource_list());
   AddKnownTagsToAdBlockInstance();
   if (test_observer_) {
     test_observer_->OnEngineUpdated();
@@ -218,26 +213,28 @@ void AdBlockEngine::AddKnownTagsToAdBlockInstance() {
                 [&](const std::string tag) { ad_block_client_->addTag(tag); });
 }
 
-void AdBlockEngine::OnListSourceLoaded(const DATFileDataBuffer& filters,
-                                       const std::string& resources_json) {
+void AdBlockEngine::OnListSourceLoaded(const DATFileData& filters,
+                                       const AdBlockResourceStore* resources) {
   UpdateAdBlockClient(
       std::make_unique<adblock::Engine>(
           reinterpret_cast<const char*>(filters.data()), filters.size()),
-      resources_json);
+      resources);
 }
 
-void AdBlockEngine::OnDATLoaded(const DATFileDataBuffer& dat_buf,
-                                const std::string& resources_json) {
+void AdBlockEngine::OnDATLoaded(const DATFileData& dat_data,
+                                const AdBlockResourceStore* resources) {
   // An empty buffer will not load successfully.
-  if (dat_buf.empty()) {
+  if (dat_data.empty()) {
     return;
   }
 
+  // Deserialize straight from the shared (usually memory-mapped) bytes; the
+  // engine builds its own structures, so no intermediate copy is needed.
   auto client = std::make_unique<adblock::Engine>();
-  client->deserialize(reinterpret_cast<const char*>(&dat_buf.front()),
-                      dat_buf.size());
+  client->deserialize(reinterpret_cast<const char*>(dat_data.data()),
+                      dat_data.size());
 
-  UpdateAdBlockClient(std::move(client), resources_json);
+  UpdateAdBlockClient(std::move(client), resources);
 }
 
 void AdBlockEngine::AddObserverForTest(AdBlockEngine::TestObserver* observer) {
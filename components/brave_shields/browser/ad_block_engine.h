@@ -14,13 +14,16 @@
 #include <utility>
 #include <vector>
 
+#include "base/memory/scoped_refptr.h"
 #include "base/memory/weak_ptr.h"
 #include "base/observer_list_types.h"
 #include "base/values.h"
 #include "brave/components/brave_component_updater/browser/dat_file_util.h"
+#include "brave/components/brave_shields/browser/ad_block_resource_store.h"
 #include "third_party/blink/public/mojom/loader/resource_load_info.mojom-shared.h"
 #include "url/gurl.h"
 
+using brave_component_updater::DATFileData;
 using brave_component_updater::DATFileDataBuffer;
 
 namespace adblock {
@@ -57,19 +60,19 @@ class AdBlockEngine : public base::SupportsWeakPtr<AdBlockEngine> {
       const GURL& url,
       blink::mojom::ResourceType resource_type,
       const std::string& tab_host);
-  void AddResources(const std::string& resources);
+  void AddResources(scoped_refptr<AdBlockResourceStore> resources);
   void EnableTag(const std::string& tag, bool enabled);
   bool TagExists(const std::string& tag);
 
   absl::optional<base::Value> UrlCosmeticResources(const std::string& url);
-  base::Value HiddenClassIdSelectors(
+  std::vector<std::string> HiddenClassIdSelectors(
       const std::vector<std::string>& classes,
       const std::vector<std::string>& ids,
       const std::vector<std::string>& exceptions);
 
   void Load(bool deserialize,
-            const DATFileDataBuffer& dat_buf,
-            const std::string& resources_json);
+            scoped_refptr<DATFileData> dat_data,
+            scoped_refptr<AdBlockResourceStore> resources);
 
   class TestObserver : public base::CheckedObserver {
    public:
@@ -81,13 +84,15 @@ class AdBlockEngine : public base::SupportsWeakPtr<AdBlockEngine> {
 
  protected:
   void AddKnownTagsToAdBlockInstance();
+  // The engine copies |resources| into its own storage, so the store doesn't
+  // need to outlive these calls.
   void UpdateAdBlockClient(std::unique_ptr<adblock::Engine> ad_block_client,
-                           const std::string& resources_json);
-  void OnListSourceLoaded(const DATFileDataBuffer& filters,
-                          const std::string& resources_json);
+                           const AdBlockResourceStore* resources);
+  void OnListSourceLoaded(const DATFileData& filters,
+                          const AdBlockResourceStore* resources);
 
-  void OnDATLoaded(const DATFileDataBuffer& dat_buf,
-                   const std::string& resources_json);
+  void OnDATLoaded(const DATFileData& dat_data,
+                   const AdBlockResourceStore* resources);
 
   std::unique_ptr<adblock::Engine> ad_block_client_;
 
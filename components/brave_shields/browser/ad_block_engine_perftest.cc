@@ -0,0 +1,312 @@
+/* Copyright (c) 2022 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "base/base_paths.h"
+#include "base/command_line.h"
+#include "base/files/file_path.h"
+#include "base/files/file_util.h"
+#include "base/path_service.h"
+#include "base/process/process_metrics.h"
+#include "base/strings/string_split.h"
+#include "base/test/task_environment.h"
+#include "base/time/time.h"
+#include "brave/components/brave_component_updater/browser/dat_file_util.h"
+#include "brave/components/brave_shields/browser/ad_block_engine.h"
+#include "testing/gtest/include/gtest/gtest.h"
+#include "testing/perf/perf_result_reporter.h"
+#include "third_party/abseil-cpp/absl/types/optional.h"
+#include "url/gurl.h"
+
+// Replays a request corpus through the default and regional adblock engines
+// and reports per-call latency, engine memory, load time and the number of
+// blocked requests. The DATs and the corpus default to the copies under
+// brave/test/data/adblock-data; point the switches below at the installed
+// component DATs and at a larger recording to measure production lists, e.g.:
+//
+//   brave_perftests --gtest_filter=AdBlockEnginePerfTest.* \
+//       --adblock-default-dat=<component dir>/rs-ABPFilterParserData.dat \
+//       --adblock-perf-corpus=<recorded corpus>.tsv
+
+namespace brave_shields {
+
+namespace {
+
+constexpr char kDefaultDatSwitch[] = "adblock-default-dat";
+constexpr char kRegionalDatSwitch[] = "adblock-regional-dat";
+constexpr char kCorpusSwitch[] = "adblock-perf-corpus";
+
+// Times the corpus is replayed, so that percentiles of small corpora are
+// stable.
+constexpr int kIterations = 10;
+
+// Class and id names commonly found on pages. A page load sends them in
+// kSelectorBatches batches, as a renderer does while the DOM is being built.
+constexpr const char* kClasses[] = {
+    "ad",        "ads",          "adsbygoogle", "advert",        "banner",
+    "sponsored", "promo",        "sidebar",     "header",        "footer",
+    "nav",       "content",      "article",     "container",     "row",
+    "col",       "btn",          "card",        "modal",         "overlay",
+    "ad-slot",   "ad-wrapper",   "dfp-ad",      "taboola",       "outbrain",
+    "share",     "newsletter",   "paywall",     "cookie-banner", "related"};
+constexpr const char* kIds[] = {
+    "main",    "header",  "footer",       "sidebar",       "content",
+    "ad-top",  "ad-side", "div-gpt-ad-1", "taboola-below", "comments",
+    "consent", "player",  "signup",       "search",        "nav"};
+constexpr size_t kSelectorBatches = 3;
+
+struct CorpusRequest {
+  GURL url;
+  std::string tab_host;
+  blink::mojom::ResourceType resource_type;
+};
+
+base::FilePath GetTestDataDir() {
+  base::FilePath source_root;
+  base::PathService::Get(base::DIR_SOURCE_ROOT, &source_root);
+  return source_root.AppendASCII("brave")
+      .AppendASCII("test")
+      .AppendASCII("data")
+      .AppendASCII("adblock-data");
+}
+
+base::FilePath GetPathFromSwitch(const char* switch_name,
+                                 const base::FilePath& default_path) {
+  const base::CommandLine* command_line =
+      base::CommandLine::ForCurrentProcess();
+  if (command_line->HasSwitch(switch_name))
+    return command_line->GetSwitchValuePath(switch_name);
+  return default_path;
+}
+
+absl::optional<blink::mojom::ResourceType> ParseResourceType(
+    const std::string& type) {
+  if (type == "main_frame")
+    return blink::mojom::ResourceType::kMainFrame;
+  if (type == "sub_frame")
+    return blink::mojom::ResourceType::kSubFrame;
+  if (type == "stylesheet")
+    return blink::mojom::ResourceType::kStylesheet;
+  if (type == "script")
+    return blink::mojom::ResourceType::kScript;
+  if (type == "image")
+    return blink::mojom::ResourceType::kImage;
+  if (type == "font")
+    return blink::mojom::ResourceType::kFontResource;
+  if (type == "xhr")
+    return blink::mojom::ResourceType::kXhr;
+  if (type == "media")
+    return blink::mojom::ResourceType::kMedia;
+  if (type == "ping")
+    return blink::mojom::ResourceType::kPing;
+  if (type == "other")
+    return blink::mojom::ResourceType::kSubResource;
+  return absl::nullopt;
+}
+
+std::vector<CorpusRequest> LoadCorpus(const base::FilePath& path) {
+  std::string contents;
+  if (!base::ReadFileToString(path, &contents))
+    return {};
+
+  std::vector<CorpusRequest> corpus;
+  for (const auto& line :
+       base::SplitString(contents, "\n", base::TRIM_WHITESPACE,
+                         base::SPLIT_WANT_NONEMPTY)) {
+    if (line[0] == '#')
+      continue;
+    std::vector<std::string> fields = base::SplitString(
+        line, "\t", base::TRIM_WHITESPACE, base::SPLIT_WANT_ALL);
+    if (fields.size() != 3)
+      continue;
+    GURL url(fields[0]);
+    absl::optional<blink::mojom::ResourceType> resource_type =
+        ParseResourceType(fields[2]);
+    if (!url.is_valid() || !resource_type)
+      continue;
+    corpus.push_back({std::move(url), fields[1], *resource_type});
+  }
+  return corpus;
+}
+
+std::vector<std::string> GetBatch(const std::vector<std::string>& items,
+                                  size_t batch,
+                                  size_t batch_count) {
+  return std::vector<std::string>(
+      items.begin() + items.size() * batch / batch_count,
+      items.begin() + items.size() * (batch + 1) / batch_count);
+}
+
+size_t GetMallocUsage() {
+  return base::ProcessMetrics::CreateCurrentProcessMetrics()->GetMallocUsage();
+}
+
+// Collects call latencies and reports their p50 and p99.
+class LatencyRecorder {
+ public:
+  explicit LatencyRecorder(const std::string& metric) : metric_(metric) {}
+
+  template <typename Callable>
+  void Time(Callable callable) {
+    const base::TimeTicks start = base::TimeTicks::Now();
+    callable();
+    samples_.push_back(base::TimeTicks::Now() - start);
+  }
+
+  void Report(perf_test::PerfResultReporter* reporter) {
+    ASSERT_FALSE(samples_.empty()) << metric_;
+    std::sort(samples_.begin(), samples_.end());
+    reporter->AddResult(metric_ + "_p50", GetPercentile(50).InMicrosecondsF());
+    reporter->AddResult(metric_ + "_p99", GetPercentile(99).InMicrosecondsF());
+  }
+
+  void Register(perf_test::PerfResultReporter* reporter) {
+    reporter->RegisterImportantMetric(metric_ + "_p50", "us");
+    reporter->RegisterImportantMetric(metric_ + "_p99", "us");
+  }
+
+ private:
+  base::TimeDelta GetPercentile(size_t percentile) const {
+    const size_t index =
+        std::min(samples_.size() - 1, samples_.size() * percentile / 100);
+    return samples_[index];
+  }
+
+  const std::string metric_;
+  std::vector<base::TimeDelta> samples_;
+};
+
+}  // namespace
+
+class AdBlockEnginePerfTest : public testing::Test {
+ public:
+  AdBlockEnginePerfTest() = default;
+  AdBlockEnginePerfTest(const AdBlockEnginePerfTest&) = delete;
+  AdBlockEnginePerfTest& operator=(const AdBlockEnginePerfTest&) = delete;
+  ~AdBlockEnginePerfTest() override = default;
+
+  void SetUp() override {
+    corpus_ = LoadCorpus(GetPathFromSwitch(
+        kCorpusSwitch,
+        GetTestDataDir().AppendASCII("perf").AppendASCII(
+            "request-corpus.tsv")));
+    ASSERT_FALSE(corpus_.empty());
+  }
+
+ protected:
+  void RunBenchmark(const std::string& story, const base::FilePath& dat_path) {
+    perf_test::PerfResultReporter reporter("AdBlockEngine", story);
+    reporter.RegisterImportantMetric(".load_time", "ms");
+    reporter.RegisterImportantMetric(".engine_memory", "bytes");
+    reporter.RegisterImportantMetric(".blocked_requests", "count");
+    LatencyRecorder should_start_request(".should_start_request");
+    LatencyRecorder csp_directives(".get_csp_directives");
+    LatencyRecorder cosmetic_resources(".url_cosmetic_resources");
+    LatencyRecorder hidden_selectors(".hidden_class_id_selectors");
+    for (auto* recorder : {&should_start_request, &csp_directives,
+                           &cosmetic_resources, &hidden_selectors}) {
+      recorder->Register(&reporter);
+    }
+
+    // The engine is loaded the way AdBlockService loads component DATs:
+    // mapped from disk and deserialized.
+    const size_t malloc_before_load = GetMallocUsage();
+    const base::TimeTicks load_start = base::TimeTicks::Now();
+    scoped_refptr<DATFileData> dat_data = DATFileData::MapFile(dat_path);
+    ASSERT_FALSE(dat_data->empty()) << dat_path;
+    auto engine = std::make_unique<AdBlockEngine>();
+    engine->Load(true, std::move(dat_data), nullptr);
+    const base::TimeDelta load_time = base::TimeTicks::Now() - load_start;
+    const size_t malloc_after_load = GetMallocUsage();
+    reporter.AddResult(".load_time", load_time);
+    reporter.AddResult(".engine_memory",
+                       malloc_after_load > malloc_before_load
+                           ? malloc_after_load - malloc_before_load
+                           : 0u);
+
+    const std::vector<std::string> classes(std::begin(kClasses),
+                                           std::end(kClasses));
+    const std::vector<std::string> ids(std::begin(kIds), std::end(kIds));
+    const std::vector<std::string> exceptions;
+
+    size_t matched_requests = 0;
+    for (int iteration = 0; iteration < kIterations; ++iteration) {
+      for (const auto& request : corpus_) {
+        bool did_match_rule = false;
+        bool did_match_exception = false;
+        bool did_match_important = false;
+        std::string mock_data_url;
+        should_start_request.Time([&]() {
+          engine->ShouldStartRequest(
+              request.url, request.resource_type, request.tab_host,
+              /*aggressive_blocking=*/false, &did_match_rule,
+              &did_match_exception, &did_match_important, &mock_data_url);
+        });
+        if (did_match_rule && !did_match_exception)
+          ++matched_requests;
+
+        csp_directives.Time([&]() {
+          engine->GetCspDirectives(request.url, request.resource_type,
+                                   request.tab_host);
+        });
+
+        if (request.resource_type != blink::mojom::ResourceType::kMainFrame)
+          continue;
+
+        // A page load asks for its cosmetic resources once, then for the
+        // selectors of the classes and ids it sees in batches.
+        cosmetic_resources.Time(
+            [&]() { engine->UrlCosmeticResources(request.url.spec()); });
+        for (size_t batch = 0; batch < kSelectorBatches; ++batch) {
+          const std::vector<std::string> class_batch =
+              GetBatch(classes, batch, kSelectorBatches);
+          const std::vector<std::string> id_batch =
+              GetBatch(ids, batch, kSelectorBatches);
+          hidden_selectors.Time([&]() {
+            engine->HiddenClassIdSelectors(class_batch, id_batch, exceptions);
+          });
+        }
+      }
+    }
+
+    for (auto* recorder : {&should_start_request, &csp_directives,
+                           &cosmetic_resources, &hidden_selectors}) {
+      recorder->Report(&reporter);
+    }
+    // Not a timing, but a change here explains a latency change.
+    reporter.AddResult(".blocked_requests", matched_requests / kIterations);
+  }
+
+ private:
+  base::test::TaskEnvironment task_environment_;
+  std::vector<CorpusRequest> corpus_;
+};
+
+TEST_F(AdBlockEnginePerfTest, DefaultEngine) {
+  RunBenchmark(
+      "default",
+      GetPathFromSwitch(kDefaultDatSwitch,
+                        GetTestDataDir()
+                            .AppendASCII("adblock-default")
+                            .AppendASCII("rs-ABPFilterParserData.dat")));
+}
+
+TEST_F(AdBlockEnginePerfTest, RegionalEngine) {
+  RunBenchmark(
+      "regional",
+      GetPathFromSwitch(
+          kRegionalDatSwitch,
+          GetTestDataDir()
+              .AppendASCII("adblock-regional")
+              .AppendASCII("9852EFC4-99E4-4F2D-A915-9C3196C7A1DE")
+              .AppendASCII("rs-9852EFC4-99E4-4F2D-A915-9C3196C7A1DE.dat")));
+}
+
+}  // namespace brave_shields
@@ -5,6 +5,8 @@
 
 #include "brave/components/brave_shields/browser/ad_block_filters_provider.h"
 
+#include <utility>
+
 namespace brave_shields {
 
 AdBlockFiltersProvider::AdBlockFiltersProvider() {}
@@ -24,9 +26,9 @@ void AdBlockFiltersProvider::RemoveObserver(
 }
 
 void AdBlockFiltersProvider::OnDATLoaded(bool deserialize,
-                                         const DATFileDataBuffer& dat_buf) {
+                                         scoped_refptr<DATFileData> dat_data) {
   for (auto& observer : observers_) {
-    observer.OnDATLoaded(deserialize, dat_buf);
+    observer.OnDATLoaded(deserialize, dat_data);
   }
 }
 
@@ -38,9 +40,9 @@ void AdBlockFiltersProvider::LoadDAT(
 
 void AdBlockFiltersProvider::OnLoad(AdBlockFiltersProvider::Observer* observer,
                                     bool deserialize,
-                                    const DATFileDataBuffer& dat_buf) {
+                                    scoped_refptr<DATFileData> dat_data) {
   if (observers_.HasObserver(observer)) {
-    observer->OnDATLoaded(deserialize, dat_buf);
+    observer->OnDATLoaded(deserialize, std::move(dat_data));
   }
 }
 
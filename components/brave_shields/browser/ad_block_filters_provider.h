@@ -7,12 +7,13 @@
 #define BRAVE_COMPONENTS_BRAVE_SHIELDS_BROWSER_AD_BLOCK_FILTERS_PROVIDER_H_
 
 #include "base/callback.h"
+#include "base/memory/scoped_refptr.h"
 #include "base/memory/weak_ptr.h"
 #include "base/observer_list.h"
 #include "base/observer_list_types.h"
 #include "brave/components/brave_component_updater/browser/dat_file_util.h"
 
-using brave_component_updater::DATFileDataBuffer;
+using brave_component_updater::DATFileData;
 
 namespace brave_shields {
 
@@ -22,8 +23,10 @@ class AdBlockFiltersProvider {
  public:
   class Observer : public base::CheckedObserver {
    public:
+    // |dat_data| is shared between every observer of the load; hold on to
+    // the reference rather than copying the bytes.
     virtual void OnDATLoaded(bool deserialize,
-                             const DATFileDataBuffer& dat_buf) = 0;
+                             scoped_refptr<DATFileData> dat_data) = 0;
   };
 
   AdBlockFiltersProvider();
@@ -41,12 +44,12 @@ class AdBlockFiltersProvider {
  protected:
   virtual void LoadDATBuffer(
       base::OnceCallback<void(bool deserialize,
-                              const DATFileDataBuffer& dat_buf)>) = 0;
+                              scoped_refptr<DATFileData> dat_data)>) = 0;
 
   void OnLoad(AdBlockFiltersProvider::Observer* observer,
               bool deserialize,
-              const DATFileDataBuffer& dat_buf);
-  void OnDATLoaded(bool deserialize, const DATFileDataBuffer& dat_buf);
+              scoped_refptr<DATFileData> dat_data);
+  void OnDATLoaded(bool deserialize, scoped_refptr<DATFileData> dat_data);
 
  private:
   base::ObserverList<Observer> observers_;
@@ -46,14 +46,15 @@ void AdBlockRegionalFiltersProvider::OnComponentReady(
 
   base::ThreadPool::PostTaskAndReplyWithResult(
       FROM_HERE, {base::MayBlock()},
-      base::BindOnce(&brave_component_updater::ReadDATFileData, dat_file_path),
+      base::BindOnce(&brave_component_updater::DATFileData::MapFile,
+                     dat_file_path),
       base::BindOnce(&AdBlockRegionalFiltersProvider::OnDATLoaded,
                      weak_factory_.GetWeakPtr(), true));
 }
 
 void AdBlockRegionalFiltersProvider::LoadDATBuffer(
-    base::OnceCallback<void(bool deserialize, const DATFileDataBuffer& dat_buf)>
-        cb) {
+    base::OnceCallback<void(bool deserialize,
+                            scoped_refptr<DATFileData> dat_data)> cb) {
   if (component_path_.empty()) {
     // If the path is not ready yet, do nothing. An update should be pushed
     // soon.
@@ -66,7 +67,8 @@ void AdBlockRegionalFiltersProvider::LoadDATBuffer(
 
   base::ThreadPool::PostTaskAndReplyWithResult(
       FROM_HERE, {base::MayBlock()},
-      base::BindOnce(&brave_component_updater::ReadDATFileData, dat_file_path),
+      base::BindOnce(&brave_component_updater::DATFileData::MapFile,
+                     dat_file_path),
       base::BindOnce(std::move(cb), true));
 }
 
@@ -38,9 +38,10 @@ class AdBlockRegionalFiltersProvider : public AdBlockFiltersProvider {
       const AdBlockRegionalFiltersProvider&) = delete;
 
   void LoadDATBuffer(
-      base::OnceCallback<void(
-          bool deserialize,
-          const brave_component_updater::DATFileDataBuffer& dat_buf)>) override;
+      base::OnceCallback<
+          void(bool deserialize,
+               scoped_refptr<brave_component_updater::DATFileData> dat_data)>)
+      override;
 
   bool Delete() && override;
 
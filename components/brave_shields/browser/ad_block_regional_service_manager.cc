@@ -5,6 +5,7 @@
 
 #include "brave/components/brave_shields/browser/ad_block_regional_service_manager.h"
 
+#include <iterator>
 #include <memory>
 #include <utility>
 #include <vector>
@@ -200,7 +201,8 @@ void AdBlockRegionalServiceManager::EnableTag(const std::string& tag,
   }
 }
 
-void AdBlockRegionalServiceManager::AddResources(const std::string& resources) {
+void AdBlockRegionalServiceManager::AddResources(
+    scoped_refptr<AdBlockResourceStore> resources) {
   base::AutoLock lock(regional_services_lock_);
   for (const auto& regional_service : regional_services_) {
     regional_service.second->AddResources(resources);
@@ -279,25 +281,23 @@ absl::optional<base::Value> AdBlockRegionalServiceManager::UrlCosmeticResources(
   return first_value;
 }
 
-base::Value AdBlockRegionalServiceManager::HiddenClassIdSelectors(
+std::vector<std::string> AdBlockRegionalServiceManager::HiddenClassIdSelectors(
     const std::vector<std::string>& classes,
     const std::vector<std::string>& ids,
     const std::vector<std::string>& exceptions) {
-  base::Value first_value(base::Value::Type::LIST);
+  std::vector<std::string> selectors;
 
   base::AutoLock lock(regional_services_lock_);
   for (auto it = regional_services_.begin(); it != regional_services_.end();
        it++) {
-    base::Value next_value =
+    std::vector<std::string> next_selectors =
         it->second->HiddenClassIdSelectors(classes, ids, exceptions);
-    DCHECK(next_value.is_list());
-
-    for (auto& value : next_value.GetList()) {
-      first_value.Append(std::move(value));
-    }
+    selectors.insert(selectors.end(),
+                     std::make_move_iterator(next_selectors.begin()),
+                     std::make_move_iterator(next_selectors.end()));
   }
 
-  return first_value;
+  return selectors;
 }
 
 void AdBlockRegionalServiceManager::SetRegionalCatalog(
@@ -72,11 +72,11 @@ class AdBlockRegionalServiceManager
       blink::mojom::ResourceType resource_type,
       const std::string& tab_host);
   void EnableTag(const std::string& tag, bool enabled);
-  void AddResources(const std::string& resources);
+  void AddResources(scoped_refptr<AdBlockResourceStore> resources);
   void EnableFilterList(const std::string& uuid, bool enabled);
 
   absl::optional<base::Value> UrlCosmeticResources(const std::string& url);
-  base::Value HiddenClassIdSelectors(
+  std::vector<std::string> HiddenClassIdSelectors(
       const std::vector<std::string>& classes,
       const std::vector<std::string>& ids,
       const std::vector<std::string>& exceptions);
@@ -26,9 +26,9 @@ void AdBlockResourceProvider::RemoveObserver(
 }
 
 void AdBlockResourceProvider::OnResourcesLoaded(
-    const std::string& resources_json) {
+    scoped_refptr<AdBlockResourceStore> resources) {
   for (auto& observer : observers_) {
-    observer.OnResourcesLoaded(resources_json);
+    observer.OnResourcesLoaded(resources);
   }
 }
 
@@ -9,9 +9,11 @@
 #include <string>
 
 #include "base/callback.h"
+#include "base/memory/scoped_refptr.h"
 #include "base/observer_list.h"
 #include "base/observer_list_types.h"
 #include "brave/components/brave_component_updater/browser/dat_file_util.h"
+#include "brave/components/brave_shields/browser/ad_block_resource_store.h"
 #include "third_party/abseil-cpp/absl/types/optional.h"
 
 using brave_component_updater::DATFileDataBuffer;
@@ -24,7 +26,8 @@ class AdBlockResourceProvider {
  public:
   class Observer : public base::CheckedObserver {
    public:
-    virtual void OnResourcesLoaded(const std::string& resources_json) = 0;
+    virtual void OnResourcesLoaded(
+        scoped_refptr<AdBlockResourceStore> resources) = 0;
   };
 
   AdBlockResourceProvider();
@@ -34,10 +37,11 @@ class AdBlockResourceProvider {
   void RemoveObserver(Observer* observer);
 
   virtual void LoadResources(
-      base::OnceCallback<void(const std::string& resources_json)>) = 0;
+      base::OnceCallback<void(scoped_refptr<AdBlockResourceStore> resources)>
+          cb) = 0;
 
  protected:
-  void OnResourcesLoaded(const std::string& resources_json);
+  void OnResourcesLoaded(scoped_refptr<AdBlockResourceStore> resources);
 
  private:
   base::ObserverList<Observer> observers_;
@@ -0,0 +1,35 @@
+/* Copyright (c) 2022 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/brave_shields/browser/ad_block_resource_store.h"
+
+#include <memory>
+#include <string>
+
+#include "base/files/file_path.h"
+#include "brave/components/adblock_rust_ffi/src/wrapper.h"
+#include "brave/components/brave_component_updater/browser/dat_file_util.h"
+
+namespace brave_shields {
+
+AdBlockResourceStore::AdBlockResourceStore(const std::string& resources_json)
+    : resource_list_(std::make_unique<adblock::ResourceList>(resources_json)) {}
+
+AdBlockResourceStore::~AdBlockResourceStore() = default;
+
+// static
+scoped_refptr<AdBlockResourceStore> AdBlockResourceStore::Create(
+    const std::string& resources_json) {
+  return base::WrapRefCounted(new AdBlockResourceStore(
+      resources_json.empty() ? std::string("[]") : resources_json));
+}
+
+// static
+scoped_refptr<AdBlockResourceStore> AdBlockResourceStore::CreateFromFile(
+    const base::FilePath& resources_path) {
+  return Create(brave_component_updater::GetDATFileAsString(resources_path));
+}
+
+}  // namespace brave_shields
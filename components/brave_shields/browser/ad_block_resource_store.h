@@ -0,0 +1,54 @@
+/* Copyright (c) 2022 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#ifndef BRAVE_COMPONENTS_BRAVE_SHIELDS_BROWSER_AD_BLOCK_RESOURCE_STORE_H_
+#define BRAVE_COMPONENTS_BRAVE_SHIELDS_BROWSER_AD_BLOCK_RESOURCE_STORE_H_
+
+#include <memory>
+#include <string>
+
+#include "base/memory/ref_counted.h"
+
+namespace adblock {
+class ResourceList;
+}  // namespace adblock
+
+namespace base {
+class FilePath;
+}  // namespace base
+
+namespace brave_shields {
+
+// Immutable set of scriptlet and redirect resources, parsed once and applied
+// to every adblock engine. Each engine copies the resources into its own
+// storage, so nothing holds on to the store after the engines have loaded it.
+class AdBlockResourceStore
+    : public base::RefCountedThreadSafe<AdBlockResourceStore> {
+ public:
+  AdBlockResourceStore(const AdBlockResourceStore&) = delete;
+  AdBlockResourceStore& operator=(const AdBlockResourceStore&) = delete;
+
+  // Parsing is not free, so callers should avoid the UI thread when the JSON
+  // is large.
+  static scoped_refptr<AdBlockResourceStore> Create(
+      const std::string& resources_json);
+  // Reads and parses |resources_path|. Blocking.
+  static scoped_refptr<AdBlockResourceStore> CreateFromFile(
+      const base::FilePath& resources_path);
+
+  const adblock::ResourceList& resource_list() const { return *resource_list_; }
+
+ private:
+  friend class base::RefCountedThreadSafe<AdBlockResourceStore>;
+
+  explicit AdBlockResourceStore(const std::string& resources_json);
+  ~AdBlockResourceStore();
+
+  const std::unique_ptr<adblock::ResourceList> resource_list_;
+};
+
+}  // namespace brave_shields
+
+#endif  // BRAVE_COMPONENTS_BRAVE_SHIELDS_BROWSER_AD_BLOCK_RESOURCE_STORE_H_
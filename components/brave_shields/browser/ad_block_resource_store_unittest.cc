@@ -0,0 +1,119 @@
+/* Copyright (c) 2022 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/brave_shields/browser/ad_block_resource_store.h"
+
+#include <memory>
+#include <string>
+
+#include "base/files/file_path.h"
+#include "base/files/file_util.h"
+#include "base/files/scoped_temp_dir.h"
+#include "brave/components/brave_component_updater/browser/dat_file_util.h"
+#include "brave/components/brave_shields/browser/ad_block_engine.h"
+#include "testing/gtest/include/gtest/gtest.h"
+#include "url/gurl.h"
+
+using brave_component_updater::DATFileData;
+using brave_component_updater::DATFileDataBuffer;
+
+namespace brave_shields {
+
+namespace {
+
+constexpr char kRedirectRule[] = "js_mock_me.js$redirect=noopjs";
+constexpr char kResources[] = R"(
+    [
+      {
+        "name": "noop.js",
+        "aliases": ["noopjs"],
+        "kind": {
+          "mime":"application/javascript"
+        },
+        "content": "KGZ1bmN0aW9uKCkgewogICAgJ3VzZSBzdHJpY3QnOwp9KSgpOwo="
+      }
+    ])";
+
+std::unique_ptr<AdBlockEngine> CreateEngine(
+    scoped_refptr<AdBlockResourceStore> resources) {
+  const std::string rules(kRedirectRule);
+  auto engine = std::make_unique<AdBlockEngine>();
+  engine->Load(false,
+               DATFileData::FromBuffer(
+                   DATFileDataBuffer(rules.begin(), rules.end())),
+               std::move(resources));
+  return engine;
+}
+
+// Returns the data URL |engine| redirects the mocked script to, if any.
+std::string GetMockDataURL(AdBlockEngine* engine) {
+  bool did_match_rule = false;
+  bool did_match_exception = false;
+  bool did_match_important = false;
+  std::string mock_data_url;
+  engine->ShouldStartRequest(GURL("https://example.com/js_mock_me.js"),
+                             blink::mojom::ResourceType::kScript,
+                             "example.com", false, &did_match_rule,
+                             &did_match_exception, &did_match_important,
+                             &mock_data_url);
+  EXPECT_TRUE(did_match_rule);
+  return mock_data_url;
+}
+
+}  // namespace
+
+TEST(AdBlockResourceStoreTest, Create) {
+  auto engine = CreateEngine(AdBlockResourceStore::Create(kResources));
+  EXPECT_FALSE(GetMockDataURL(engine.get()).empty());
+}
+
+TEST(AdBlockResourceStoreTest, CreateWithInvalidJson) {
+  auto engine = CreateEngine(AdBlockResourceStore::Create(""));
+  EXPECT_TRUE(GetMockDataURL(engine.get()).empty());
+
+  engine = CreateEngine(AdBlockResourceStore::Create("not json"));
+  EXPECT_TRUE(GetMockDataURL(engine.get()).empty());
+}
+
+TEST(AdBlockResourceStoreTest, CreateFromFile) {
+  base::ScopedTempDir temp_dir;
+  ASSERT_TRUE(temp_dir.CreateUniqueTempDir());
+  const base::FilePath path = temp_dir.GetPath().AppendASCII("resources.json");
+  ASSERT_TRUE(base::WriteFile(path, kResources));
+
+  auto engine = CreateEngine(AdBlockResourceStore::CreateFromFile(path));
+  EXPECT_FALSE(GetMockDataURL(engine.get()).empty());
+}
+
+TEST(AdBlockResourceStoreTest, CreateFromMissingFile) {
+  base::ScopedTempDir temp_dir;
+  ASSERT_TRUE(temp_dir.CreateUniqueTempDir());
+
+  auto engine = CreateEngine(AdBlockResourceStore::CreateFromFile(
+      temp_dir.GetPath().AppendASCII("resources.json")));
+  EXPECT_TRUE(GetMockDataURL(engine.get()).empty());
+}
+
+TEST(AdBlockResourceStoreTest, SharedAcrossEngines) {
+  scoped_refptr<AdBlockResourceStore> resources =
+      AdBlockResourceStore::Create(kResources);
+
+  auto first_engine = CreateEngine(resources);
+  auto second_engine = std::make_unique<AdBlockEngine>();
+  second_engine->AddResources(resources);
+  auto third_engine = CreateEngine(resources);
+
+  // Engines take their own copy, so the store can go away once all of them
+  // have loaded it.
+  EXPECT_TRUE(resources->HasOneRef());
+  const std::string mock_data_url = GetMockDataURL(first_engine.get());
+  resources.reset();
+
+  EXPECT_FALSE(mock_data_url.empty());
+  EXPECT_EQ(GetMockDataURL(first_engine.get()), mock_data_url);
+  EXPECT_EQ(GetMockDataURL(third_engine.get()), mock_data_url);
+}
+
+}  // namespace brave_shields
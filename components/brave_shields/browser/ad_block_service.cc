@@ -6,6 +6,7 @@
 #include "brave/components/brave_shields/browser/ad_block_service.h"
 
 #include <algorithm>
+#include <iterator>
 #include <utility>
 
 #include "base/base_paths.h"
@@ -81,9 +82,9 @@ AdBlockService::SourceProviderObserver::~SourceProviderObserver() {
 
 void AdBlockService::SourceProviderObserver::OnDATLoaded(
     bool deserialize,
-    const DATFileDataBuffer& dat_buf) {
+    scoped_refptr<DATFileData> dat_data) {
   deserialize_ = deserialize;
-  dat_buf_ = std::move(dat_buf);
+  dat_data_ = std::move(dat_data);
   // multiple AddObserver calls are ignored
   resource_provider_->AddObserver(this);
   resource_provider_->LoadResources(base::BindOnce(
@@ -91,16 +92,16 @@ void AdBlockService::SourceProviderObserver::OnDATLoaded(
 }
 
 void AdBlockService::SourceProviderObserver::OnResourcesLoaded(
-    const std::string& resources_json) {
-  if (dat_buf_.empty()) {
+    scoped_refptr<AdBlockResourceStore> resources) {
+  if (!dat_data_ || dat_data_->empty()) {
     task_runner_->PostTask(
         FROM_HERE, base::BindOnce(&AdBlockEngine::AddResources, adblock_engine_,
-                                  resources_json));
+                                  std::move(resources)));
   } else {
     task_runner_->PostTask(
         FROM_HERE,
         base::BindOnce(&AdBlockEngine::Load, adblock_engine_, deserialize_,
-                       std::move(dat_buf_), resources_json));
+                       std::move(dat_data_), std::move(resources)));
   }
 }
 
@@ -203,52 +204,39 @@ absl::optional<base::Value> AdBlockService::UrlCosmeticResources(
   return resources;
 }
 
-// The return value here is formatted differently from the rest of the adblock
-// service instances. We need to distinguish between selectors returned from
-// the default engine and those returned by other engines, but still comply
-// with the virtual method signature.
-// This can be improved once interfaces are decoupled in
-// https://github.com/brave/brave-core/pull/10994.
-// For now, this returns a dict with two properties:
-//  - "hide_selectors" - wraps the result from the default engine
-//  - "force_hide_selectors" - wraps appended results from all other engines
-base::Value AdBlockService::HiddenClassIdSelectors(
+// Selectors from the default engine are returned separately from those of all
+// other engines: |hide_selectors| are still subject to first-party unhiding in
+// the renderer, while |force_hide_selectors| are always hidden.
+void AdBlockService::HiddenClassIdSelectors(
     const std::vector<std::string>& classes,
     const std::vector<std::string>& ids,
-    const std::vector<std::string>& exceptions) {
+    const std::vector<std::string>& exceptions,
+    std::vector<std::string>* hide_selectors,
+    std::vector<std::string>* force_hide_selectors) {
   DCHECK(GetTaskRunner()->RunsTasksInCurrentSequence());
-  base::Value hide_selectors =
+  DCHECK(hide_selectors);
+  DCHECK(force_hide_selectors);
+  *hide_selectors =
       default_service()->HiddenClassIdSelectors(classes, ids, exceptions);
 
-  base::Value regional_selectors =
-      regional_service_manager()->HiddenClassIdSelectors(classes, ids,
-                                                         exceptions);
-  DCHECK(regional_selectors.is_list());
+  *force_hide_selectors = regional_service_manager()->HiddenClassIdSelectors(
+      classes, ids, exceptions);
 
-  base::Value custom_selectors =
+  std::vector<std::string> custom_selectors =
       custom_filters_service()->HiddenClassIdSelectors(classes, ids,
                                                        exceptions);
-  DCHECK(custom_selectors.is_list());
+  force_hide_selectors->insert(
+      force_hide_selectors->end(),
+      std::make_move_iterator(custom_selectors.begin()),
+      std::make_move_iterator(custom_selectors.end()));
 
-  base::Value subscription_selectors =
+  std::vector<std::string> subscription_selectors =
       subscription_service_manager()->HiddenClassIdSelectors(classes, ids,
                                                              exceptions);
-  DCHECK(subscription_selectors.is_list());
-
-  base::Value force_hide_selectors = std::move(regional_selectors);
-
-  for (auto& custom_selector : custom_selectors.GetList()) {
-    force_hide_selectors.Append(std::move(custom_selector));
-  }
-
-  for (auto& subscription_selectors : subscription_selectors.GetList()) {
-    force_hide_selectors.Append(std::move(subscription_selectors));
-  }
-
-  base::Value result(base::Value::Type::DICTIONARY);
-  result.SetKey("hide_selectors", std::move(hide_selectors));
-  result.SetKey("force_hide_selectors", std::move(force_hide_selectors));
-  return result;
+  force_hide_selectors->insert(
+      force_hide_selectors->end(),
+      std::make_move_iterator(subscription_selectors.begin()),
+      std::make_move_iterator(subscription_selectors.end()));
 }
 
 AdBlockRegionalServiceManager* AdBlockService::regional_service_manager() {
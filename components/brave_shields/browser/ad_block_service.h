@@ -65,13 +65,14 @@ class AdBlockService {
    private:
     // AdBlockFiltersProvider::Observer
     void OnDATLoaded(bool deserialize,
-                     const DATFileDataBuffer& dat_buf) override;
+                     scoped_refptr<DATFileData> dat_data) override;
 
     // AdBlockResourceProvider::Observer
-    void OnResourcesLoaded(const std::string& resources_json) override;
+    void OnResourcesLoaded(
+        scoped_refptr<AdBlockResourceStore> resources) override;
 
     bool deserialize_;
-    DATFileDataBuffer dat_buf_;
+    scoped_refptr<DATFileData> dat_data_;
     base::WeakPtr<AdBlockEngine> adblock_engine_;
     raw_ptr<AdBlockFiltersProvider> filters_provider_;    // not owned
     raw_ptr<AdBlockResourceProvider> resource_provider_;  // not owned
@@ -103,10 +104,11 @@ class AdBlockService {
       blink::mojom::ResourceType resource_type,
       const std::string& tab_host);
   absl::optional<base::Value> UrlCosmeticResources(const std::string& url);
-  base::Value HiddenClassIdSelectors(
-      const std::vector<std::string>& classes,
-      const std::vector<std::string>& ids,
-      const std::vector<std::string>& exceptions);
+  void HiddenClassIdSelectors(const std::vector<std::string>& classes,
+                              const std::vector<std::string>& ids,
+                              const std::vector<std::string>& exceptions,
+                              std::vector<std::string>* hide_selectors,
+                              std::vector<std::string>* force_hide_selectors);
 
   AdBlockRegionalServiceManager* regional_service_manager();
   AdBlockEngine* custom_filters_service();
@@ -24,11 +24,12 @@ AdBlockSubscriptionFiltersProvider::AdBlockSubscriptionFiltersProvider(
 AdBlockSubscriptionFiltersProvider::~AdBlockSubscriptionFiltersProvider() {}
 
 void AdBlockSubscriptionFiltersProvider::LoadDATBuffer(
-    base::OnceCallback<void(bool deserialize, const DATFileDataBuffer& dat_buf)>
-        cb) {
+    base::OnceCallback<void(bool deserialize,
+                            scoped_refptr<DATFileData> dat_data)> cb) {
   base::ThreadPool::PostTaskAndReplyWithResult(
       FROM_HERE, {base::MayBlock()},
-      base::BindOnce(&brave_component_updater::ReadDATFileData, list_file_),
+      base::BindOnce(&brave_component_updater::DATFileData::MapFile,
+                     list_file_),
       base::BindOnce(std::move(cb), false));
 }
 
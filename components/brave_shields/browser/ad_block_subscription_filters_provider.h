@@ -11,7 +11,7 @@
 #include "brave/components/brave_component_updater/browser/dat_file_util.h"
 #include "brave/components/brave_shields/browser/ad_block_filters_provider.h"
 
-using brave_component_updater::DATFileDataBuffer;
+using brave_component_updater::DATFileData;
 
 class PrefService;
 
@@ -29,7 +29,7 @@ class AdBlockSubscriptionFiltersProvider : public AdBlockFiltersProvider {
 
   void LoadDATBuffer(
       base::OnceCallback<void(bool deserialize,
-                              const DATFileDataBuffer& dat_buf)>) override;
+                              scoped_refptr<DATFileData> dat_data)>) override;
 
  private:
   base::FilePath list_file_;
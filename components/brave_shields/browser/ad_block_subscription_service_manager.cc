@@ -5,6 +5,7 @@
 
 #include "brave/components/brave_shields/browser/ad_block_subscription_service_manager.h"
 
+#include <iterator>
 #include <memory>
 #include <utility>
 #include <vector>
@@ -464,7 +465,7 @@ void AdBlockSubscriptionServiceManager::EnableTag(const std::string& tag,
 }
 
 void AdBlockSubscriptionServiceManager::AddResources(
-    const std::string& resources) {
+    scoped_refptr<AdBlockResourceStore> resources) {
   DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
   for (const auto& subscription_service : subscription_services_) {
     subscription_service.second->AddResources(resources);
@@ -496,28 +497,27 @@ AdBlockSubscriptionServiceManager::UrlCosmeticResources(
   return first_value;
 }
 
-base::Value AdBlockSubscriptionServiceManager::HiddenClassIdSelectors(
+std::vector<std::string>
+AdBlockSubscriptionServiceManager::HiddenClassIdSelectors(
     const std::vector<std::string>& classes,
     const std::vector<std::string>& ids,
     const std::vector<std::string>& exceptions) {
-  base::Value first_value(base::Value::Type::LIST);
+  std::vector<std::string> selectors;
 
   base::AutoLock lock(subscription_services_lock_);
   for (auto it = subscription_services_.begin();
        it != subscription_services_.end(); it++) {
     auto info = GetInfo(it->first);
     if (info && info->enabled) {
-      base::Value next_value =
+      std::vector<std::string> next_selectors =
           it->second->HiddenClassIdSelectors(classes, ids, exceptions);
-      DCHECK(next_value.is_list());
-
-      for (auto& item : next_value.GetList()) {
-        first_value.Append(std::move(item));
-      }
+      selectors.insert(selectors.end(),
+                       std::make_move_iterator(next_selectors.begin()),
+                       std::make_move_iterator(next_selectors.end()));
     }
   }
 
-  return first_value;
+  return selectors;
 }
 
 void AdBlockSubscriptionServiceManager::OnSubscriptionDownloaded(
@@ -0,0 +1,85 @@
+/* Copyright (c) 2022 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/brave_shields/browser/shields_settings_cache.h"
+
+#include "components/content_settings/core/browser/host_content_settings_map.h"
+#include "components/content_settings/core/common/content_settings_types.h"
+#include "url/origin.h"
+
+namespace brave_shields {
+
+namespace {
+
+// Tab origins are few, so this is only a guard against unbounded growth.
+constexpr size_t kMaxCachedOrigins = 256;
+
+bool IsSnapshotContentSetting(ContentSettingsType content_type) {
+  switch (content_type) {
+    case ContentSettingsType::BRAVE_SHIELDS:
+    case ContentSettingsType::BRAVE_ADS:
+    case ContentSettingsType::BRAVE_COSMETIC_FILTERING:
+    case ContentSettingsType::BRAVE_HTTP_UPGRADABLE_RESOURCES:
+    case ContentSettingsType::BRAVE_REFERRERS:
+      return true;
+    default:
+      return false;
+  }
+}
+
+}  // namespace
+
+ShieldsSettings::ShieldsSettings() = default;
+
+ShieldsSettings::~ShieldsSettings() = default;
+
+// static
+scoped_refptr<const ShieldsSettings> ShieldsSettings::Create(
+    HostContentSettingsMap* map,
+    const GURL& url) {
+  auto settings = base::WrapRefCounted(new ShieldsSettings());
+  settings->shields_enabled = GetBraveShieldsEnabled(map, url);
+  settings->ad_control_type = GetAdControlType(map, url);
+  settings->cosmetic_filtering_control_type =
+      GetCosmeticFilteringControlType(map, url);
+  settings->https_everywhere_enabled = GetHTTPSEverywhereEnabled(map, url);
+  settings->allow_referrers = AllowReferrers(map, url);
+  return settings;
+}
+
+ShieldsSettingsCache::ShieldsSettingsCache(HostContentSettingsMap* map)
+    : map_(map) {
+  map_->AddObserver(this);
+}
+
+ShieldsSettingsCache::~ShieldsSettingsCache() {
+  map_->RemoveObserver(this);
+}
+
+scoped_refptr<const ShieldsSettings> ShieldsSettingsCache::GetSettings(
+    const GURL& url) {
+  // Shields patterns never look past the origin; opaque origins map to GURL().
+  const GURL origin = url::Origin::Create(url).GetURL();
+  auto it = settings_.find(origin);
+  if (it != settings_.end())
+    return it->second;
+
+  if (settings_.size() >= kMaxCachedOrigins)
+    settings_.clear();
+  scoped_refptr<const ShieldsSettings> settings =
+      ShieldsSettings::Create(map_, origin);
+  settings_.emplace(origin, settings);
+  return settings;
+}
+
+void ShieldsSettingsCache::OnContentSettingChanged(
+    const ContentSettingsPattern& primary_pattern,
+    const ContentSettingsPattern& secondary_pattern,
+    ContentSettingsType content_type) {
+  if (IsSnapshotContentSetting(content_type))
+    settings_.clear();
+}
+
+}  // namespace brave_shields
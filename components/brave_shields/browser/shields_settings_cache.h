@@ -0,0 +1,73 @@
+/* Copyright (c) 2022 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#ifndef BRAVE_COMPONENTS_BRAVE_SHIELDS_BROWSER_SHIELDS_SETTINGS_CACHE_H_
+#define BRAVE_COMPONENTS_BRAVE_SHIELDS_BROWSER_SHIELDS_SETTINGS_CACHE_H_
+
+#include <map>
+
+#include "base/memory/raw_ptr.h"
+#include "base/memory/ref_counted.h"
+#include "brave/components/brave_shields/browser/brave_shields_util.h"
+#include "components/content_settings/core/browser/content_settings_observer.h"
+#include "components/keyed_service/core/keyed_service.h"
+#include "url/gurl.h"
+
+class HostContentSettingsMap;
+
+namespace brave_shields {
+
+// Shields settings of one origin, as read from HostContentSettingsMap.
+struct ShieldsSettings : public base::RefCounted<ShieldsSettings> {
+  ShieldsSettings(const ShieldsSettings&) = delete;
+  ShieldsSettings& operator=(const ShieldsSettings&) = delete;
+
+  static scoped_refptr<const ShieldsSettings> Create(
+      HostContentSettingsMap* map,
+      const GURL& url);
+
+  bool shields_enabled = true;
+  ControlType ad_control_type = ControlType::BLOCK;
+  ControlType cosmetic_filtering_control_type = ControlType::BLOCK_THIRD_PARTY;
+  bool https_everywhere_enabled = true;
+  bool allow_referrers = false;
+
+ private:
+  friend class base::RefCounted<ShieldsSettings>;
+
+  ShieldsSettings();
+  ~ShieldsSettings();
+};
+
+// Keeps a ShieldsSettings snapshot per origin so that requests to the same
+// tab origin share a single set of content settings lookups. Snapshots are
+// dropped whenever one of the shields content settings they read changes.
+class ShieldsSettingsCache : public KeyedService,
+                             public content_settings::Observer {
+ public:
+  explicit ShieldsSettingsCache(HostContentSettingsMap* map);
+  ShieldsSettingsCache(const ShieldsSettingsCache&) = delete;
+  ShieldsSettingsCache& operator=(const ShieldsSettingsCache&) = delete;
+  ~ShieldsSettingsCache() override;
+
+  // Returns the settings for the origin of |url|. The snapshot never changes;
+  // a settings change makes later calls return a new one.
+  scoped_refptr<const ShieldsSettings> GetSettings(const GURL& url);
+
+  size_t size_for_testing() const { return settings_.size(); }
+
+ private:
+  // content_settings::Observer overrides:
+  void OnContentSettingChanged(const ContentSettingsPattern& primary_pattern,
+                               const ContentSettingsPattern& secondary_pattern,
+                               ContentSettingsType content_type) override;
+
+  raw_ptr<HostContentSettingsMap> map_ = nullptr;
+  std::map<GURL, scoped_refptr<const ShieldsSettings>> settings_;
+};
+
+}  // namespace brave_shields
+
+#endif  // BRAVE_COMPONENTS_BRAVE_SHIELDS_BROWSER_SHIELDS_SETTINGS_CACHE_H_
@@ -0,0 +1,97 @@
+/* Copyright (c) 2022 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/brave_shields/browser/shields_settings_cache.h"
+
+#include <memory>
+
+#include "brave/components/brave_shields/browser/brave_shields_util.h"
+#include "chrome/browser/content_settings/host_content_settings_map_factory.h"
+#include "chrome/test/base/testing_profile.h"
+#include "components/content_settings/core/browser/host_content_settings_map.h"
+#include "content/public/test/browser_task_environment.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+using brave_shields::ControlType;
+using brave_shields::ShieldsSettings;
+using brave_shields::ShieldsSettingsCache;
+
+class ShieldsSettingsCacheTest : public testing::Test {
+ public:
+  ShieldsSettingsCacheTest() = default;
+  ShieldsSettingsCacheTest(const ShieldsSettingsCacheTest&) = delete;
+  ShieldsSettingsCacheTest& operator=(const ShieldsSettingsCacheTest&) =
+      delete;
+  ~ShieldsSettingsCacheTest() override = default;
+
+  void SetUp() override {
+    profile_ = std::make_unique<TestingProfile>();
+    cache_ = std::make_unique<ShieldsSettingsCache>(map());
+  }
+
+  void TearDown() override { cache_.reset(); }
+
+  HostContentSettingsMap* map() {
+    return HostContentSettingsMapFactory::GetForProfile(profile_.get());
+  }
+  ShieldsSettingsCache* cache() { return cache_.get(); }
+
+ private:
+  content::BrowserTaskEnvironment task_environment_;
+  std::unique_ptr<TestingProfile> profile_;
+  std::unique_ptr<ShieldsSettingsCache> cache_;
+};
+
+TEST_F(ShieldsSettingsCacheTest, MatchesContentSettings) {
+  const GURL url("https://brave.com/path");
+  brave_shields::SetAdControlType(map(), ControlType::ALLOW, url);
+  brave_shields::SetHTTPSEverywhereEnabled(map(), false, url);
+
+  scoped_refptr<const ShieldsSettings> settings = cache()->GetSettings(url);
+  EXPECT_EQ(settings->shields_enabled,
+            brave_shields::GetBraveShieldsEnabled(map(), url));
+  EXPECT_EQ(settings->ad_control_type, ControlType::ALLOW);
+  EXPECT_EQ(settings->cosmetic_filtering_control_type,
+            brave_shields::GetCosmeticFilteringControlType(map(), url));
+  EXPECT_FALSE(settings->https_everywhere_enabled);
+  EXPECT_EQ(settings->allow_referrers,
+            brave_shields::AllowReferrers(map(), url));
+
+  settings = cache()->GetSettings(GURL("https://example.com/"));
+  EXPECT_EQ(settings->ad_control_type, ControlType::BLOCK);
+  EXPECT_TRUE(settings->https_everywhere_enabled);
+}
+
+TEST_F(ShieldsSettingsCacheTest, SharesSnapshotPerOrigin) {
+  scoped_refptr<const ShieldsSettings> settings =
+      cache()->GetSettings(GURL("https://brave.com/a"));
+  EXPECT_EQ(settings, cache()->GetSettings(GURL("https://brave.com/b?q=1")));
+  EXPECT_NE(settings, cache()->GetSettings(GURL("https://example.com/")));
+  EXPECT_EQ(cache()->size_for_testing(), 2u);
+}
+
+TEST_F(ShieldsSettingsCacheTest, SettingChangeInvalidatesSnapshots) {
+  const GURL url("https://brave.com/");
+  scoped_refptr<const ShieldsSettings> before = cache()->GetSettings(url);
+  EXPECT_TRUE(before->shields_enabled);
+
+  brave_shields::SetBraveShieldsEnabled(map(), false, url);
+  EXPECT_EQ(cache()->size_for_testing(), 0u);
+
+  scoped_refptr<const ShieldsSettings> after = cache()->GetSettings(url);
+  EXPECT_FALSE(after->shields_enabled);
+  // Snapshots already handed out are left as they were.
+  EXPECT_TRUE(before->shields_enabled);
+}
+
+TEST_F(ShieldsSettingsCacheTest, UnrelatedSettingKeepsSnapshots) {
+  const GURL url("https://brave.com/");
+  scoped_refptr<const ShieldsSettings> settings = cache()->GetSettings(url);
+
+  map()->SetContentSettingDefaultScope(url, GURL(),
+                                       ContentSettingsType::GEOLOCATION,
+                                       CONTENT_SETTING_BLOCK);
+  EXPECT_EQ(settings, cache()->GetSettings(url));
+}
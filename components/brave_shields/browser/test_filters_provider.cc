@@ -19,27 +19,29 @@ TestFiltersProvider::TestFiltersProvider(const base::FilePath& dat_location,
     : resources_(resources) {
   CHECK(!dat_location.empty());
 
-  dat_buffer_ = brave_component_updater::ReadDATFileData(dat_location);
+  dat_data_ = DATFileData::MapFile(dat_location);
 
-  CHECK(!dat_buffer_.empty());
+  CHECK(!dat_data_->empty());
 }
 
 TestFiltersProvider::~TestFiltersProvider() {}
 
 void TestFiltersProvider::LoadDATBuffer(
-    base::OnceCallback<void(bool deserialize, const DATFileDataBuffer& dat_buf)>
-        cb) {
-  if (dat_buffer_.empty()) {
-    auto buffer = std::vector<unsigned char>(rules_.begin(), rules_.end());
-    std::move(cb).Run(false, buffer);
+    base::OnceCallback<void(bool deserialize,
+                            scoped_refptr<DATFileData> dat_data)> cb) {
+  if (!dat_data_) {
+    brave_component_updater::DATFileDataBuffer buffer(rules_.begin(),
+                                                      rules_.end());
+    std::move(cb).Run(false, DATFileData::FromBuffer(std::move(buffer)));
   } else {
-    std::move(cb).Run(true, dat_buffer_);
+    std::move(cb).Run(true, dat_data_);
   }
 }
 
 void TestFiltersProvider::LoadResources(
-    base::OnceCallback<void(const std::string& resources_json)> cb) {
-  std::move(cb).Run(resources_);
+    base::OnceCallback<void(scoped_refptr<AdBlockResourceStore> resources)>
+        cb) {
+  std::move(cb).Run(AdBlockResourceStore::Create(resources_));
 }
 
 }  // namespace brave_shields
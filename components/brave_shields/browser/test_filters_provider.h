@@ -7,15 +7,15 @@
 #define BRAVE_COMPONENTS_BRAVE_SHIELDS_BROWSER_TEST_FILTERS_PROVIDER_H_
 
 #include <string>
-#include <vector>
 
 #include "base/callback.h"
 #include "base/files/file_path.h"
+#include "base/memory/scoped_refptr.h"
 #include "brave/components/brave_component_updater/browser/dat_file_util.h"
 #include "brave/components/brave_shields/browser/ad_block_filters_provider.h"
 #include "brave/components/brave_shields/browser/ad_block_resource_provider.h"
 
-using brave_component_updater::DATFileDataBuffer;
+using brave_component_updater::DATFileData;
 
 namespace brave_shields {
 
@@ -29,13 +29,15 @@ class TestFiltersProvider : public AdBlockFiltersProvider,
 
   void LoadDATBuffer(
       base::OnceCallback<void(bool deserialize,
-                              const DATFileDataBuffer& dat_buf)> cb) override;
+                              scoped_refptr<DATFileData> dat_data)> cb)
+      override;
 
   void LoadResources(
-      base::OnceCallback<void(const std::string& resources_json)> cb) override;
+      base::OnceCallback<void(scoped_refptr<AdBlockResourceStore> resources)>
+          cb) override;
 
  private:
-  DATFileDataBuffer dat_buffer_;
+  scoped_refptr<DATFileData> dat_data_;
   std::string rules_;
   std::string resources_;
 };
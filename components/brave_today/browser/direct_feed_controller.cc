@@ -25,8 +25,11 @@
 #include "brave/components/brave_today/common/pref_names.h"
 #include "brave/components/brave_today/rust/lib.rs.h"
 #include "components/prefs/pref_service.h"
+#include "crypto/sha2.h"
 #include "net/base/load_flags.h"
 #include "net/http/http_request_headers.h"
+#include "net/http/http_response_headers.h"
+#include "net/http/http_status_code.h"
 #include "services/network/public/cpp/resource_request.h"
 #include "services/network/public/cpp/shared_url_loader_factory.h"
 #include "services/network/public/cpp/simple_url_loader.h"
@@ -108,12 +111,9 @@ void DirectFeedController::DownloadAllContent(
         std::vector<mojom::FeedItemPtr> all_feed_articles;
         all_feed_articles.reserve(total_size);
         for (auto& collection : results) {
-          auto it = collection.begin();
-          while (it != collection.end()) {
-            all_feed_articles.insert(
-                all_feed_articles.end(),
-                mojom::FeedItem::NewArticle(*std::make_move_iterator(it)));
-            it = collection.erase(it);
+          for (auto& article : collection) {
+            all_feed_articles.push_back(
+                mojom::FeedItem::NewArticle(std::move(article)));
           }
         }
         std::move(callback).Run(std::move(all_feed_articles));
@@ -126,9 +126,15 @@ void DirectFeedController::DownloadAllContent(
   for (auto& publisher : publishers) {
     VLOG(1) << "Downloading feed content from "
             << publisher->feed_source.spec();
+    direct_feed_urls.insert(publisher->feed_source);
     DownloadFeedContent(publisher->feed_source, publisher->publisher_id,
                         feed_content_handler);
   }
+  // Forget feeds which are no longer a source, e.g. ones the user removed or
+  // only verified without adding.
+  base::EraseIf(feed_cache_, [&direct_feed_urls](const auto& cached_feed) {
+    return !direct_feed_urls.contains(cached_feed.first);
+  });
 }
 
 void DirectFeedController::DownloadFeedContent(const GURL& feed_url,
@@ -184,6 +190,17 @@ void DirectFeedController::DownloadFeed(const GURL& feed_url,
   request->load_flags = net::LOAD_DO_NOT_SAVE_COOKIES;
   request->credentials_mode = network::mojom::CredentialsMode::kOmit;
   request->method = net::HttpRequestHeaders::kGetMethod;
+  auto cached_feed = feed_cache_.find(feed_url);
+  if (cached_feed != feed_cache_.end()) {
+    if (!cached_feed->second.etag.empty()) {
+      request->headers.SetHeader(net::HttpRequestHeaders::kIfNoneMatch,
+                                 cached_feed->second.etag);
+    }
+    if (!cached_feed->second.last_modified.empty()) {
+      request->headers.SetHeader(net::HttpRequestHeaders::kIfModifiedSince,
+                                 cached_feed->second.last_modified);
+    }
+  }
   auto url_loader = network::SimpleURLLoader::Create(
       std::move(request), GetNetworkTrafficAnnotationTag());
   url_loader->SetRetryOptions(
@@ -207,25 +224,50 @@ void DirectFeedController::OnResponse(
   // Parse response data
   auto* loader = iter->get();
   auto response_code = -1;
-  base::flat_map<std::string, std::string> headers;
+  std::string etag;
+  std::string last_modified;
   if (loader->ResponseInfo()) {
     auto headers_list = loader->ResponseInfo()->headers;
     if (headers_list) {
       response_code = headers_list->response_code();
+      headers_list->GetNormalizedHeader("etag", &etag);
+      headers_list->GetNormalizedHeader("last-modified", &last_modified);
     }
   }
   url_loaders_.erase(iter);
+  auto result = std::make_unique<DirectFeedResponse>(DirectFeedResponse());
+  result->url = feed_url;
+  auto cached_feed = feed_cache_.find(feed_url);
+  // Nothing changed since the last download, reuse what we parsed then.
+  if (response_code == net::HTTP_NOT_MODIFIED &&
+      cached_feed != feed_cache_.end()) {
+    VLOG(1) << feed_url.spec() << " not modified.";
+    result->success = true;
+    result->data = cached_feed->second.data;
+    std::move(callback).Run(std::move(result));
+    return;
+  }
   // Validate if we get a feed
   std::string body_content = response_body ? *response_body : "";
   // TODO(petemill): handle any url redirects and change the stored feed url?
-  auto result = std::make_unique<DirectFeedResponse>(DirectFeedResponse());
-  result->url = feed_url;
   if (response_code < 200 || response_code >= 300 || body_content.empty()) {
     VLOG(1) << feed_url.spec()
             << " invalid response, status: " << response_code;
     std::move(callback).Run(std::move(result));
     return;
   }
+  // Sources without validators still often serve the same body.
+  const std::string body_hash = crypto::SHA256HashString(body_content);
+  if (cached_feed != feed_cache_.end() &&
+      cached_feed->second.body_hash == body_hash) {
+    VLOG(1) << feed_url.spec() << " unchanged.";
+    cached_feed->second.etag = etag;
+    cached_feed->second.last_modified = last_modified;
+    result->success = true;
+    result->data = cached_feed->second.data;
+    std::move(callback).Run(std::move(result));
+    return;
+  }
   // Reponse is valid, but still might not be a feed
   FeedData data;
   if (!parse_feed_string(::rust::String(body_content), data)) {
@@ -236,6 +278,11 @@ void DirectFeedController::OnResponse(
     return;
   }
   // Valid feed
+  CachedFeed& cache_entry = feed_cache_[feed_url];
+  cache_entry.etag = etag;
+  cache_entry.last_modified = last_modified;
+  cache_entry.body_hash = body_hash;
+  cache_entry.data = data;
   result->success = true;
   result->data = data;
   std::move(callback).Run(std::move(result));
@@ -12,6 +12,7 @@
 #include <vector>
 
 #include "base/callback_forward.h"
+#include "base/containers/flat_map.h"
 #include "base/memory/scoped_refptr.h"
 #include "brave/components/brave_today/common/brave_news.mojom-forward.h"
 #include "brave/components/brave_today/rust/lib.rs.h"
@@ -61,6 +62,17 @@ class DirectFeedController {
  private:
   using SimpleURLLoaderList =
       std::list<std::unique_ptr<network::SimpleURLLoader>>;
+
+  // Last parsed content of a feed, reused when the source answers a
+  // conditional request with 304 Not Modified or sends an identical body.
+  struct CachedFeed {
+    std::string etag;
+    std::string last_modified;
+    // SHA-256 of the body the data was parsed from.
+    std::string body_hash;
+    FeedData data;
+  };
+
   void DownloadFeedContent(const GURL& feed_url,
                            const std::string& publisher_id,
                            GetArticlesCallback callback);
@@ -72,6 +84,7 @@ class DirectFeedController {
 
   SimpleURLLoaderList url_loaders_;
   scoped_refptr<network::SharedURLLoaderFactory> url_loader_factory_;
+  base::flat_map<GURL, CachedFeed> feed_cache_;
 };
 
 }  // namespace brave_news
@@ -12,7 +12,18 @@
 
 #include "base/containers/flat_map.h"
 #include "base/logging.h"
+#include "base/run_loop.h"
+#include "base/test/bind.h"
+#include "brave/components/brave_today/browser/direct_feed_controller.h"
+#include "brave/components/brave_today/common/brave_news.mojom.h"
 #include "brave/components/brave_today/rust/lib.rs.h"
+#include "content/public/test/browser_task_environment.h"
+#include "net/http/http_request_headers.h"
+#include "net/http/http_status_code.h"
+#include "services/network/public/cpp/resource_request.h"
+#include "services/network/public/cpp/weak_wrapper_shared_url_loader_factory.h"
+#include "services/network/test/test_url_loader_factory.h"
+#include "services/network/test/test_utils.h"
 #include "testing/gtest/include/gtest/gtest.h"
 
 namespace brave_news {
@@ -140,4 +151,101 @@ TEST(BraveNewsDirectFeed, ParseFeed) {
             "c5f85f34aa685221604f7e434415ca82");
 }
 
+class BraveNewsDirectFeedControllerTest : public testing::Test {
+ public:
+  BraveNewsDirectFeedControllerTest()
+      : direct_feed_controller_(
+            base::MakeRefCounted<network::WeakWrapperSharedURLLoaderFactory>(
+                &test_url_loader_factory_)) {}
+
+ protected:
+  bool VerifyFeedUrl(const GURL& feed_url) {
+    bool result = false;
+    base::RunLoop run_loop;
+    direct_feed_controller_.VerifyFeedUrl(
+        feed_url,
+        base::BindOnce(
+            [](bool* result, base::OnceClosure quit, const bool is_valid,
+               const std::string& title) {
+              *result = is_valid;
+              std::move(quit).Run();
+            },
+            &result, run_loop.QuitClosure()));
+    run_loop.Run();
+    return result;
+  }
+
+  void DownloadAllContent(const GURL& feed_url) {
+    std::vector<mojom::PublisherPtr> publishers;
+    auto publisher = mojom::Publisher::New();
+    publisher->publisher_id = "direct";
+    publisher->feed_source = feed_url;
+    publisher->type = mojom::PublisherType::DIRECT_SOURCE;
+    publishers.push_back(std::move(publisher));
+    base::RunLoop run_loop;
+    direct_feed_controller_.DownloadAllContent(
+        std::move(publishers),
+        base::BindLambdaForTesting(
+            [&run_loop](std::vector<mojom::FeedItemPtr>) { run_loop.Quit(); }));
+    run_loop.Run();
+  }
+
+  void AddResponse(const GURL& feed_url,
+                   net::HttpStatusCode status,
+                   const std::string& etag,
+                   const std::string& body) {
+    auto head = network::CreateURLResponseHead(status);
+    if (!etag.empty())
+      head->headers->AddHeader("ETag", etag);
+    test_url_loader_factory_.ClearResponses();
+    test_url_loader_factory_.AddResponse(feed_url, std::move(head), body,
+                                         network::URLLoaderCompletionStatus());
+  }
+
+  content::BrowserTaskEnvironment task_environment_;
+  network::TestURLLoaderFactory test_url_loader_factory_;
+  DirectFeedController direct_feed_controller_;
+};
+
+TEST_F(BraveNewsDirectFeedControllerTest, ReusesFeedWhenNotModified) {
+  const GURL feed_url("https://www.example.com/feed.xml");
+  std::string if_none_match;
+  test_url_loader_factory_.SetInterceptor(base::BindLambdaForTesting(
+      [&](const network::ResourceRequest& request) {
+        if_none_match.clear();
+        request.headers.GetHeader(net::HttpRequestHeaders::kIfNoneMatch,
+                                  &if_none_match);
+      }));
+
+  // First download has no validator to send and parses the body.
+  AddResponse(feed_url, net::HTTP_OK, "\"v1\"", GetFeedJson());
+  EXPECT_TRUE(VerifyFeedUrl(feed_url));
+  EXPECT_TRUE(if_none_match.empty());
+
+  // Second download is conditional and the cached feed is used.
+  AddResponse(feed_url, net::HTTP_NOT_MODIFIED, "", "");
+  EXPECT_TRUE(VerifyFeedUrl(feed_url));
+  EXPECT_EQ("\"v1\"", if_none_match);
+}
+
+TEST_F(BraveNewsDirectFeedControllerTest, NotModifiedWithoutCacheFails) {
+  const GURL feed_url("https://www.example.com/feed.xml");
+  AddResponse(feed_url, net::HTTP_NOT_MODIFIED, "", "");
+  EXPECT_FALSE(VerifyFeedUrl(feed_url));
+}
+
+TEST_F(BraveNewsDirectFeedControllerTest, ForgetsFeedsNoLongerSources) {
+  const GURL feed_url("https://www.example.com/feed.xml");
+  const GURL other_feed_url("https://www.example.org/feed.xml");
+  AddResponse(feed_url, net::HTTP_OK, "\"v1\"", GetFeedJson());
+  EXPECT_TRUE(VerifyFeedUrl(feed_url));
+
+  // Refreshing the sources without |feed_url| drops its cached feed, so a
+  // later 304 for it has nothing to reuse.
+  AddResponse(other_feed_url, net::HTTP_OK, "", GetFeedJson());
+  DownloadAllContent(other_feed_url);
+  AddResponse(feed_url, net::HTTP_NOT_MODIFIED, "", "");
+  EXPECT_FALSE(VerifyFeedUrl(feed_url));
+}
+
 }  // namespace brave_news
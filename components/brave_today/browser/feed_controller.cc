@@ -5,6 +5,7 @@
 
 #include "brave/components/brave_today/browser/feed_controller.h"
 
+#include <algorithm>
 #include <memory>
 #include <string>
 #include <unordered_set>
@@ -15,6 +16,7 @@
 #include "base/bind.h"
 #include "base/callback_forward.h"
 #include "base/one_shot_event.h"
+#include "base/task/thread_pool.h"
 #include "brave/components/api_request_helper/api_request_helper.h"
 #include "brave/components/brave_private_cdn/headers.h"
 #include "brave/components/brave_today/browser/direct_feed_controller.h"
@@ -32,6 +34,7 @@ namespace brave_news {
 namespace {
 
 const char kEtagHeaderKey[] = "etag";
+const char kIfNoneMatchHeaderKey[] = "If-None-Match";
 
 GURL GetFeedUrl() {
   GURL feed_url("https://" + brave_today::GetHostname() + "/brave-today/feed." +
@@ -39,6 +42,48 @@ GURL GetFeedUrl() {
   return feed_url;
 }
 
+// Parsing and building work on the whole multi-megabyte feed, so it runs
+// off the UI sequence.
+constexpr base::TaskTraits kFeedProcessingTaskTraits = {
+    base::TaskPriority::USER_VISIBLE,
+    base::TaskShutdownBehavior::SKIP_ON_SHUTDOWN};
+
+FeedItems ParseFeedItemsInBackground(std::string body) {
+  FeedItems feed_items;
+  ParseFeedItems(body, &feed_items);
+  return feed_items;
+}
+
+SharedFeedItems ShareFeedItems(FeedItems feed_items) {
+  return base::MakeRefCounted<base::RefCountedData<FeedItems>>(
+      std::move(feed_items));
+}
+
+mojom::FeedPtr BuildFeedInBackground(
+    std::vector<SharedFeedItems> feed_items_unflat,
+    std::unordered_set<std::string> history_hosts,
+    Publishers publishers) {
+  // BuildFeed moves the articles out of the items it is given, while the
+  // combined feed's items are kept for the next conditional request, so the
+  // build works on a flat copy.
+  std::size_t total_size = 0;
+  for (const auto& collection : feed_items_unflat) {
+    total_size += collection->data.size();
+  }
+  FeedItems feed_items;
+  feed_items.reserve(total_size);
+  for (const auto& collection : feed_items_unflat) {
+    for (const auto& item : collection->data) {
+      feed_items.push_back(item->Clone());
+    }
+  }
+  auto feed = mojom::Feed::New();
+  if (!BuildFeed(feed_items, history_hosts, &publishers, feed.get())) {
+    VLOG(1) << "ParseFeed reported failure.";
+  }
+  return feed;
+}
+
 }  // namespace
 
 FeedController::FeedController(
@@ -115,11 +160,10 @@ void FeedController::EnsureFeedIsUpdating() {
         // Fetch https request via callback
         auto feed_items_handler = base::BindOnce(
             [](FeedController* controller, Publishers publishers,
-               std::vector<FeedItems> feed_items_unflat) {
-              // flatten the vectors
+               std::vector<SharedFeedItems> feed_items_unflat) {
               std::size_t total_size = 0;
               for (const auto& collection : feed_items_unflat) {
-                total_size += collection.size();
+                total_size += collection->data.size();
               }
               VLOG(1) << "All feed item fetches done with item count: "
                       << total_size;
@@ -127,20 +171,11 @@ void FeedController::EnsureFeedIsUpdating() {
                 controller->NotifyUpdateDone();
                 return;
               }
-              FeedItems all_feed_items;
-              all_feed_items.reserve(total_size);
-              for (auto& collection : feed_items_unflat) {
-                auto it = collection.begin();
-                while (it != collection.end()) {
-                  all_feed_items.insert(all_feed_items.end(),
-                                        *std::make_move_iterator(it));
-                  it = collection.erase(it);
-                }
-              }
 
               // Get history hosts via callback
               auto onHistory = base::BindOnce(
-                  [](FeedController* controller, FeedItems all_feed_items,
+                  [](FeedController* controller,
+                     std::vector<SharedFeedItems> feed_items_unflat,
                      Publishers publishers, history::QueryResults results) {
                     std::unordered_set<std::string> history_hosts;
                     for (const auto& item : results) {
@@ -148,18 +183,19 @@ void FeedController::EnsureFeedIsUpdating() {
                       history_hosts.insert(host);
                     }
                     VLOG(1) << "history hosts # " << history_hosts.size();
-                    // Parse directly to in-memory property
-                    controller->ResetFeed();
-                    std::vector<mojom::FeedItemPtr> feed_items;
-                    if (BuildFeed(all_feed_items, history_hosts, &publishers,
-                                  &controller->current_feed_)) {
-                    } else {
-                      VLOG(1) << "ParseFeed reported failure.";
-                    }
-                    // Let any callbacks know that the data is ready or errored.
-                    controller->NotifyUpdateDone();
+                    // Build the feed in the background and only swap the
+                    // finished pages into the in-memory property.
+                    base::ThreadPool::PostTaskAndReplyWithResult(
+                        FROM_HERE, kFeedProcessingTaskTraits,
+                        base::BindOnce(&BuildFeedInBackground,
+                                       std::move(feed_items_unflat),
+                                       std::move(history_hosts),
+                                       std::move(publishers)),
+                        base::BindOnce(&FeedController::OnFeedBuilt,
+                                       controller->weak_ptr_factory_
+                                           .GetWeakPtr()));
                   },
-                  base::Unretained(controller), std::move(all_feed_items),
+                  base::Unretained(controller), std::move(feed_items_unflat),
                   std::move(publishers));
               history::QueryOptions options;
               options.max_count = 2000;
@@ -170,13 +206,19 @@ void FeedController::EnsureFeedIsUpdating() {
             },
             base::Unretained(controller), std::move(publishers));
         // Perform all feed downloads in parallel
-        auto fetch_items_handler =
-            base::BarrierCallback<FeedItems>(2, std::move(feed_items_handler));
+        auto fetch_items_handler = base::BarrierCallback<SharedFeedItems>(
+            2, std::move(feed_items_handler));
         controller->FetchCombinedFeed(fetch_items_handler);
         VLOG(1) << "Feed Controller found " << direct_feed_publishers.size()
                 << " direct feeds.";
         controller->direct_feed_controller_->DownloadAllContent(
-            std::move(direct_feed_publishers), fetch_items_handler);
+            std::move(direct_feed_publishers),
+            base::BindOnce(
+                [](GetSharedFeedItemsCallback callback, FeedItems feed_items) {
+                  std::move(callback).Run(
+                      ShareFeedItems(std::move(feed_items)));
+                },
+                fetch_items_handler));
       },
       base::Unretained(this)));
 }
@@ -233,6 +275,8 @@ void FeedController::UpdateIfRemoteChanged() {
 
 void FeedController::ClearCache() {
   ResetFeed();
+  current_feed_etag_.clear();
+  current_feed_items_.reset();
 }
 
 void FeedController::OnPublishersUpdated(PublishersController* controller) {
@@ -240,10 +284,11 @@ void FeedController::OnPublishersUpdated(PublishersController* controller) {
   EnsureFeedIsUpdating();
 }
 
-void FeedController::FetchCombinedFeed(GetFeedItemsCallback callback) {
+void FeedController::FetchCombinedFeed(GetSharedFeedItemsCallback callback) {
   // Handle the response
   auto response_handler = base::BindOnce(
-      [](FeedController* controller, GetFeedItemsCallback callback, int status,
+      [](FeedController* controller, GetSharedFeedItemsCallback callback,
+         int status,
          const std::string& body,
          const base::flat_map<std::string, std::string>& headers) {
         std::string etag;
@@ -251,27 +296,55 @@ void FeedController::FetchCombinedFeed(GetFeedItemsCallback callback) {
           etag = headers.at(kEtagHeaderKey);
         }
         VLOG(1) << "Downloaded feed, status: " << status << " etag: " << etag;
+        // Feed hasn't changed since we last parsed it, e.g. when only the
+        // publishers changed.
+        if (status == 304 && controller->current_feed_items_) {
+          VLOG(1) << "Feed not modified, reusing parsed items";
+          std::move(callback).Run(controller->current_feed_items_);
+          return;
+        }
         // Handle bad response
         if (status != 200 || body.empty()) {
           LOG(ERROR) << "Bad response from brave news feed.json. Status: "
                      << status;
-          std::move(callback).Run({});
+          std::move(callback).Run(ShareFeedItems({}));
           return;
         }
-        // Only mark cache time of remote request if
-        // parsing was successful
-        controller->current_feed_etag_ = etag;
-        FeedItems feed_items;
-        ParseFeedItems(body, &feed_items);
-        std::move(callback).Run(std::move(feed_items));
+        base::ThreadPool::PostTaskAndReplyWithResult(
+            FROM_HERE, kFeedProcessingTaskTraits,
+            base::BindOnce(&ParseFeedItemsInBackground, body),
+            base::BindOnce(&FeedController::OnFeedItemsParsed,
+                           controller->weak_ptr_factory_.GetWeakPtr(),
+                           std::move(callback), etag));
       },
       base::Unretained(this), std::move(callback));
-  // Send the request
+  // Send the request, conditional on the feed we already have.
+  auto headers = brave::private_cdn_headers;
+  if (!current_feed_etag_.empty() && current_feed_items_) {
+    headers[kIfNoneMatchHeaderKey] = current_feed_etag_;
+  }
   GURL feed_url(GetFeedUrl());
   VLOG(1) << "Making feed request to " << feed_url.spec();
   api_request_helper_->Request("GET", feed_url, "", "", true,
-                               std::move(response_handler),
-                               brave::private_cdn_headers);
+                               std::move(response_handler), headers);
+}
+
+void FeedController::OnFeedItemsParsed(GetSharedFeedItemsCallback callback,
+                                       const std::string& etag,
+                                       FeedItems feed_items) {
+  SharedFeedItems shared_feed_items = ShareFeedItems(std::move(feed_items));
+  // Only mark cache time of remote request if parsing was successful
+  if (!shared_feed_items->data.empty()) {
+    current_feed_etag_ = etag;
+    current_feed_items_ = shared_feed_items;
+  }
+  std::move(callback).Run(std::move(shared_feed_items));
+}
+
+void FeedController::OnFeedBuilt(mojom::FeedPtr feed) {
+  current_feed_ = std::move(*feed);
+  // Let any callbacks know that the data is ready or errored.
+  NotifyUpdateDone();
 }
 
 void FeedController::GetOrFetchFeed(base::OnceClosure callback) {
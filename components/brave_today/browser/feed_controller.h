@@ -11,6 +11,8 @@
 #include <vector>
 
 #include "base/memory/raw_ptr.h"
+#include "base/memory/ref_counted.h"
+#include "base/memory/weak_ptr.h"
 #include "base/one_shot_event.h"
 #include "base/scoped_observation.h"
 #include "brave/components/api_request_helper/api_request_helper.h"
@@ -28,6 +30,10 @@ namespace brave_news {
 using GetFeedCallback = mojom::BraveNewsController::GetFeedCallback;
 using FeedItems = std::vector<mojom::FeedItemPtr>;
 using GetFeedItemsCallback = base::OnceCallback<void(FeedItems)>;
+// Feed items that are shared instead of copied, e.g. between the controller
+// and a feed build on the thread pool. They must not be modified once shared.
+using SharedFeedItems = scoped_refptr<base::RefCountedData<FeedItems>>;
+using GetSharedFeedItemsCallback = base::OnceCallback<void(SharedFeedItems)>;
 
 class FeedController : public PublishersController::Observer {
  public:
@@ -64,7 +70,11 @@ class FeedController : public PublishersController::Observer {
   void OnPublishersUpdated(PublishersController* publishers) override;
 
  private:
-  void FetchCombinedFeed(GetFeedItemsCallback callback);
+  void FetchCombinedFeed(GetSharedFeedItemsCallback callback);
+  void OnFeedItemsParsed(GetSharedFeedItemsCallback callback,
+                         const std::string& etag,
+                         FeedItems feed_items);
+  void OnFeedBuilt(mojom::FeedPtr feed);
   void GetOrFetchFeed(base::OnceClosure callback);
   void ResetFeed();
   void NotifyUpdateDone();
@@ -85,7 +95,12 @@ class FeedController : public PublishersController::Observer {
   // every time the UI opens.
   mojom::Feed current_feed_;
   std::string current_feed_etag_;
+  // Parsed items of the last combined feed download. Reused when the server
+  // answers a conditional request for |current_feed_etag_| with 304.
+  SharedFeedItems current_feed_items_;
   bool is_update_in_progress_ = false;
+
+  base::WeakPtrFactory<FeedController> weak_ptr_factory_{this};
 };
 
 }  // namespace brave_news
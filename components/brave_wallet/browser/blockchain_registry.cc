@@ -8,11 +8,30 @@
 #include <algorithm>
 #include <utility>
 
+#include "base/strings/string_util.h"
 #include "base/strings/stringprintf.h"
 #include "brave/components/brave_wallet/browser/brave_wallet_constants.h"
 
 namespace brave_wallet {
 
+namespace {
+
+// EVM addresses are hex and compared case insensitively, other addresses such
+// as base58 Solana mints are case sensitive.
+std::string GetContractKey(const std::string& contract) {
+  if (base::StartsWith(contract, "0x", base::CompareCase::INSENSITIVE_ASCII))
+    return base::ToLowerASCII(contract);
+  return contract;
+}
+
+}  // namespace
+
+BlockchainRegistry::TokenIndex::TokenIndex() = default;
+BlockchainRegistry::TokenIndex::~TokenIndex() = default;
+BlockchainRegistry::TokenIndex::TokenIndex(TokenIndex&&) = default;
+BlockchainRegistry::TokenIndex& BlockchainRegistry::TokenIndex::operator=(
+    TokenIndex&&) = default;
+
 BlockchainRegistry::BlockchainRegistry() = default;
 
 BlockchainRegistry::~BlockchainRegistry() {}
@@ -35,6 +54,42 @@ void BlockchainRegistry::Bind(
 
 void BlockchainRegistry::UpdateTokenList(TokenListMap token_list_map) {
   token_list_map_ = std::move(token_list_map);
+
+  token_index_map_.clear();
+  for (const auto& [chain_id, tokens] : token_list_map_) {
+    std::vector<std::pair<std::string, size_t>> by_contract;
+    std::vector<std::pair<std::string, size_t>> by_symbol;
+    by_contract.reserve(tokens.size());
+    by_symbol.reserve(tokens.size());
+    for (size_t i = 0; i < tokens.size(); ++i) {
+      by_contract.emplace_back(GetContractKey(tokens[i]->contract_address), i);
+      by_symbol.emplace_back(tokens[i]->symbol, i);
+    }
+    // flat_map keeps the first of duplicate keys, which matches the order a
+    // linear scan of the list would find them in.
+    TokenIndex index;
+    index.by_contract =
+        base::flat_map<std::string, size_t>(std::move(by_contract));
+    index.by_symbol = base::flat_map<std::string, size_t>(std::move(by_symbol));
+    token_index_map_.emplace(chain_id, std::move(index));
+  }
+}
+
+const mojom::BlockchainTokenPtr* BlockchainRegistry::FindToken(
+    const std::string& chain_id,
+    bool by_contract,
+    const std::string& key) const {
+  const auto index_it = token_index_map_.find(chain_id);
+  const auto tokens_it = token_list_map_.find(chain_id);
+  if (index_it == token_index_map_.end() || tokens_it == token_list_map_.end())
+    return nullptr;
+
+  const auto& lookup = by_contract ? index_it->second.by_contract
+                                   : index_it->second.by_symbol;
+  const auto token_it = lookup.find(key);
+  if (token_it == lookup.end())
+    return nullptr;
+  return &tokens_it->second[token_it->second];
 }
 
 void BlockchainRegistry::GetTokenByContract(
@@ -47,38 +102,16 @@ void BlockchainRegistry::GetTokenByContract(
 mojom::BlockchainTokenPtr BlockchainRegistry::GetTokenByContract(
     const std::string& chain_id,
     const std::string& contract) {
-  if (token_list_map_.find(chain_id) == token_list_map_.end())
-    return nullptr;
-
-  const auto& tokens = token_list_map_[chain_id];
-  auto token_it =
-      std::find_if(tokens.begin(), tokens.end(),
-                   [&](const mojom::BlockchainTokenPtr& current_token) {
-                     return current_token->contract_address == contract;
-                   });
-  return token_it == tokens.end() ? nullptr : token_it->Clone();
+  const auto* token =
+      FindToken(chain_id, true /* by_contract */, GetContractKey(contract));
+  return token ? token->Clone() : nullptr;
 }
 
 void BlockchainRegistry::GetTokenBySymbol(const std::string& chain_id,
                                           const std::string& symbol,
                                           GetTokenBySymbolCallback callback) {
-  if (token_list_map_.find(chain_id) == token_list_map_.end()) {
-    std::move(callback).Run(nullptr);
-    return;
-  }
-  const auto& tokens = token_list_map_[chain_id];
-  auto token_it =
-      std::find_if(tokens.begin(), tokens.end(),
-                   [&](const mojom::BlockchainTokenPtr& current_token) {
-                     return current_token->symbol == symbol;
-                   });
-
-  if (token_it == tokens.end()) {
-    std::move(callback).Run(nullptr);
-    return;
-  }
-
-  std::move(callback).Run(token_it->Clone());
+  const auto* token = FindToken(chain_id, false /* by_contract */, symbol);
+  std::move(callback).Run(token ? token->Clone() : nullptr);
 }
 
 void BlockchainRegistry::GetAllTokens(const std::string& chain_id,
@@ -6,9 +6,11 @@
 #ifndef BRAVE_COMPONENTS_BRAVE_WALLET_BROWSER_BLOCKCHAIN_REGISTRY_H_
 #define BRAVE_COMPONENTS_BRAVE_WALLET_BROWSER_BLOCKCHAIN_REGISTRY_H_
 
+#include <map>
 #include <string>
 #include <vector>
 
+#include "base/containers/flat_map.h"
 #include "base/memory/singleton.h"
 #include "brave/components/brave_wallet/browser/blockchain_list_parser.h"
 #include "brave/components/brave_wallet/common/brave_wallet.mojom.h"
@@ -61,6 +63,27 @@ class BlockchainRegistry : public mojom::BlockchainRegistry {
   BlockchainRegistry();
 
  private:
+  // Lookup tables into the token list of a single chain, built once per
+  // UpdateTokenList so lookups don't scan and compare every token.
+  struct TokenIndex {
+    TokenIndex();
+    ~TokenIndex();
+    TokenIndex(TokenIndex&&);
+    TokenIndex& operator=(TokenIndex&&);
+
+    // Contract address, lower cased if it is an EVM one -> position in the
+    // chain's token list.
+    base::flat_map<std::string, size_t> by_contract;
+    // Symbol -> position in the chain's token list.
+    base::flat_map<std::string, size_t> by_symbol;
+  };
+
+  const mojom::BlockchainTokenPtr* FindToken(
+      const std::string& chain_id,
+      bool by_contract,
+      const std::string& key) const;
+
+  std::map<std::string, TokenIndex> token_index_map_;
   mojo::ReceiverSet<mojom::BlockchainRegistry> receivers_;
 };
 
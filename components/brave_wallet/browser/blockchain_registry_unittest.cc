@@ -48,6 +48,26 @@ const char token_list_json[] = R"(
    }
   })";
 
+const char solana_token_list_json[] = R"(
+  {
+   "EPjFWdd5AufqSSqeM2qN1xzybapC8G4wEGGkZwyTDt1v": {
+     "name": "USD Coin",
+     "logo": "usdc.png",
+     "erc20": false,
+     "symbol": "USDC",
+     "decimals": 6,
+     "chainId": "0x65"
+   },
+   "EPjFWdd5AufqSSqeM2qN1xzybapC8G4wEGGkZwyTDt1V": {
+     "name": "Mixed Case Token",
+     "logo": "mct.png",
+     "erc20": false,
+     "symbol": "MCT",
+     "decimals": 6,
+     "chainId": "0x65"
+   }
+  })";
+
 }  // namespace
 
 TEST(BlockchainRegistryUnitTest, GetAllTokens) {
@@ -136,6 +156,14 @@ TEST(BlockchainRegistryUnitTest, GetTokenByContract) {
       }));
   run_loop.Run();
 
+  // Contract addresses are matched case insensitively
+  EXPECT_EQ(registry
+                ->GetTokenByContract(
+                    mojom::kMainnetChainId,
+                    "0x0d8775f648430679a709e98d2b0cb6250d2887ef")
+                ->symbol,
+            "BAT");
+
   // Can get other chain tokens
   base::RunLoop run_loop2;
   registry->GetTokenByContract(
@@ -167,6 +195,28 @@ TEST(BlockchainRegistryUnitTest, GetTokenByContract) {
   run_loop4.Run();
 }
 
+TEST(BlockchainRegistryUnitTest, GetTokenByContractSolana) {
+  base::test::TaskEnvironment task_environment;
+  auto* registry = BlockchainRegistry::GetInstance();
+  TokenListMap token_list_map;
+  ASSERT_TRUE(ParseTokenList(solana_token_list_json, &token_list_map));
+  registry->UpdateTokenList(std::move(token_list_map));
+
+  // Mint addresses are base58 and matched case sensitively
+  auto token = registry->GetTokenByContract(
+      mojom::kSolanaMainnet, "EPjFWdd5AufqSSqeM2qN1xzybapC8G4wEGGkZwyTDt1v");
+  ASSERT_TRUE(token);
+  EXPECT_EQ(token->symbol, "USDC");
+
+  token = registry->GetTokenByContract(
+      mojom::kSolanaMainnet, "EPjFWdd5AufqSSqeM2qN1xzybapC8G4wEGGkZwyTDt1V");
+  ASSERT_TRUE(token);
+  EXPECT_EQ(token->symbol, "MCT");
+
+  EXPECT_FALSE(registry->GetTokenByContract(
+      mojom::kSolanaMainnet, "epjfwdd5aufqssqem2qn1xzybapc8g4weggkzwytdt1v"));
+}
+
 TEST(BlockchainRegistryUnitTest, GetTokenBySymbol) {
   base::test::TaskEnvironment task_environment;
   auto* registry = BlockchainRegistry::GetInstance();
@@ -131,6 +131,24 @@ std::vector<base::Value> Eip2930Transaction::AccessListToValue(
   return access_list;
 }
 
+// static
+void Eip2930Transaction::AppendAccessList(const AccessList& list,
+                                          RLPWriter* writer) {
+  DCHECK(writer);
+  writer->BeginList();
+  for (const AccessListItem& item : list) {
+    writer->BeginList();
+    writer->AppendBytes(item.address);
+    writer->BeginList();
+    for (const AccessedStorageKey& key : item.storage_keys) {
+      writer->AppendBytes(key);
+    }
+    writer->EndList();
+    writer->EndList();
+  }
+  writer->EndList();
+}
+
 // static
 absl::optional<Eip2930Transaction::AccessList>
 Eip2930Transaction::ValueToAccessList(const base::Value& value) {
@@ -154,51 +172,49 @@ Eip2930Transaction::ValueToAccessList(const base::Value& value) {
 std::vector<uint8_t> Eip2930Transaction::GetMessageToSign(uint256_t chain_id,
                                                           bool hash) const {
   DCHECK(nonce_);
+  const std::vector<uint8_t> to = to_.bytes();
+  RLPWriter writer;
+  writer.BeginList();
+  writer.AppendUint256(chain_id_);
+  writer.AppendUint256(nonce_.value());
+  writer.AppendUint256(gas_price_);
+  writer.AppendUint256(gas_limit_);
+  writer.AppendBytes(to);
+  writer.AppendUint256(value_);
+  writer.AppendBytes(data_);
+  AppendAccessList(access_list_, &writer);
+  writer.EndList();
+
   std::vector<uint8_t> result;
+  result.reserve(1 + writer.GetEncodedSize());
   result.push_back(type_);
-
-  // TODO(darkdh): Migrate to std::vector<base::Value>, base::ListValue is
-  // deprecated
-  base::ListValue list;
-  list.Append(RLPUint256ToBlobValue(chain_id_));
-  list.Append(RLPUint256ToBlobValue(nonce_.value()));
-  list.Append(RLPUint256ToBlobValue(gas_price_));
-  list.Append(RLPUint256ToBlobValue(gas_limit_));
-  list.Append(base::Value(to_.bytes()));
-  list.Append(RLPUint256ToBlobValue(value_));
-  list.Append(base::Value(data_));
-  list.Append(base::Value(AccessListToValue(access_list_)));
-
-  const std::string rlp_msg = RLPEncode(std::move(list));
-  result.insert(result.end(), rlp_msg.begin(), rlp_msg.end());
+  writer.Serialize(&result);
   return hash ? KeccakHash(result) : result;
 }
 
 std::string Eip2930Transaction::GetSignedTransaction() const {
   DCHECK(IsSigned());
   DCHECK(nonce_);
-
-  // TODO(darkdh): Migrate to std::vector<base::Value>, base::ListValue is
-  // deprecated
-  base::ListValue list;
-  list.Append(RLPUint256ToBlobValue(chain_id_));
-  list.Append(RLPUint256ToBlobValue(nonce_.value()));
-  list.Append(RLPUint256ToBlobValue(gas_price_));
-  list.Append(RLPUint256ToBlobValue(gas_limit_));
-  list.Append(base::Value(to_.bytes()));
-  list.Append(RLPUint256ToBlobValue(value_));
-  list.Append(base::Value(data_));
-  list.Append(base::Value(AccessListToValue(access_list_)));
-  list.Append(RLPUint256ToBlobValue(v_));
-  list.Append(base::Value(r_));
-  list.Append(base::Value(s_));
+  const std::vector<uint8_t> to = to_.bytes();
+  RLPWriter writer;
+  writer.BeginList();
+  writer.AppendUint256(chain_id_);
+  writer.AppendUint256(nonce_.value());
+  writer.AppendUint256(gas_price_);
+  writer.AppendUint256(gas_limit_);
+  writer.AppendBytes(to);
+  writer.AppendUint256(value_);
+  writer.AppendBytes(data_);
+  AppendAccessList(access_list_, &writer);
+  writer.AppendUint256(v_);
+  writer.AppendBytes(r_);
+  writer.AppendBytes(s_);
+  writer.EndList();
 
   std::vector<uint8_t> result;
+  result.reserve(1 + writer.GetEncodedSize());
   result.push_back(type_);
-
-  const std::string rlp_msg = RLPEncode(std::move(list));
-  result.insert(result.end(), rlp_msg.begin(), rlp_msg.end());
-
+  writer.Serialize(&result);
   return ToHex(result);
 }
 
@@ -15,6 +15,8 @@
 
 namespace brave_wallet {
 
+class RLPWriter;
+
 class Eip2930Transaction : public EthTransaction {
  public:
   typedef std::array<uint8_t, 20> AccessedAddress;
@@ -77,6 +79,9 @@ class Eip2930Transaction : public EthTransaction {
                      const std::vector<uint8_t>& data,
                      uint256_t chain_id);
 
+  // Writes [[{20 bytes}, [{32 bytes}...]]...] without copying the list.
+  static void AppendAccessList(const AccessList& list, RLPWriter* writer);
+
   uint256_t chain_id_;
   AccessList access_list_;
 };
@@ -153,38 +153,46 @@ absl::optional<EthTransaction> EthTransaction::FromValue(
 std::vector<uint8_t> EthTransaction::GetMessageToSign(uint256_t chain_id,
                                                       bool hash) const {
   DCHECK(nonce_);
-  base::ListValue list;
-  list.Append(RLPUint256ToBlobValue(nonce_.value()));
-  list.Append(RLPUint256ToBlobValue(gas_price_));
-  list.Append(RLPUint256ToBlobValue(gas_limit_));
-  list.Append(base::Value(to_.bytes()));
-  list.Append(RLPUint256ToBlobValue(value_));
-  list.Append(base::Value(data_));
+  const std::vector<uint8_t> to = to_.bytes();
+  RLPWriter writer;
+  writer.BeginList();
+  writer.AppendUint256(nonce_.value());
+  writer.AppendUint256(gas_price_);
+  writer.AppendUint256(gas_limit_);
+  writer.AppendBytes(to);
+  writer.AppendUint256(value_);
+  writer.AppendBytes(data_);
   if (chain_id) {
-    list.Append(RLPUint256ToBlobValue(chain_id));
-    list.Append(RLPUint256ToBlobValue(0));
-    list.Append(RLPUint256ToBlobValue(0));
+    writer.AppendUint256(chain_id);
+    writer.AppendUint256(0);
+    writer.AppendUint256(0);
   }
+  writer.EndList();
 
-  const std::string message = RLPEncode(std::move(list));
-  auto result = std::vector<uint8_t>(message.begin(), message.end());
+  std::vector<uint8_t> result;
+  writer.Serialize(&result);
   return hash ? KeccakHash(result) : result;
 }
 
 std::string EthTransaction::GetSignedTransaction() const {
   DCHECK(nonce_);
-  base::ListValue list;
-  list.Append(RLPUint256ToBlobValue(nonce_.value()));
-  list.Append(RLPUint256ToBlobValue(gas_price_));
-  list.Append(RLPUint256ToBlobValue(gas_limit_));
-  list.Append(base::Value(to_.bytes()));
-  list.Append(RLPUint256ToBlobValue(value_));
-  list.Append(base::Value(data_));
-  list.Append(RLPUint256ToBlobValue(v_));
-  list.Append(base::Value(r_));
-  list.Append(base::Value(s_));
-
-  return ToHex(RLPEncode(std::move(list)));
+  const std::vector<uint8_t> to = to_.bytes();
+  RLPWriter writer;
+  writer.BeginList();
+  writer.AppendUint256(nonce_.value());
+  writer.AppendUint256(gas_price_);
+  writer.AppendUint256(gas_limit_);
+  writer.AppendBytes(to);
+  writer.AppendUint256(value_);
+  writer.AppendBytes(data_);
+  writer.AppendUint256(v_);
+  writer.AppendBytes(r_);
+  writer.AppendBytes(s_);
+  writer.EndList();
+
+  std::vector<uint8_t> result;
+  writer.Serialize(&result);
+  return ToHex(result);
 }
 
 bool EthTransaction::ProcessVRS(const std::string& v,
@@ -72,6 +72,9 @@ TEST(EthereumKeyringUnitTest, Accounts) {
     EXPECT_EQ(accounts[i], keyring.GetAddress(i));
     EXPECT_EQ(keyring.GetAccountIndex(accounts[i]), i);
   }
+  // memoized address of the removed account is dropped too
+  EXPECT_FALSE(
+      keyring.GetAccountIndex("0x02e77f0e2fa06F95BDEa79Fad158477723145838"));
 
   keyring.AddAccounts(1);
   EXPECT_EQ(keyring.GetAccounts().size(), 3u);
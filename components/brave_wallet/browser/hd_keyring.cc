@@ -33,17 +33,15 @@ void HDKeyring::AddAccounts(size_t number) {
 }
 
 std::vector<std::string> HDKeyring::GetAccounts() const {
-  std::vector<std::string> addresses;
-  for (size_t i = 0; i < accounts_.size(); ++i) {
-    addresses.push_back(GetAddress(i));
-  }
-  return addresses;
+  EnsureAccountAddressesCached();
+  return account_addresses_;
 }
 
 absl::optional<size_t> HDKeyring::GetAccountIndex(
     const std::string& address) const {
-  for (size_t i = 0; i < accounts_.size(); ++i) {
-    if (GetAddress(i) == address) {
+  EnsureAccountAddressesCached();
+  for (size_t i = 0; i < account_addresses_.size(); ++i) {
+    if (account_addresses_[i] == address) {
       return i;
     }
   }
@@ -56,6 +54,8 @@ size_t HDKeyring::GetAccountsNumber() const {
 
 void HDKeyring::RemoveAccount() {
   accounts_.pop_back();
+  if (account_addresses_.size() > accounts_.size())
+    account_addresses_.resize(accounts_.size());
 }
 
 bool HDKeyring::AddImportedAddress(const std::string& address,
@@ -64,10 +64,8 @@ bool HDKeyring::AddImportedAddress(const std::string& address,
   if (imported_accounts_[address])
     return false;
   // Check if it is duplicate in derived accounts
-  for (size_t i = 0; i < accounts_.size(); ++i) {
-    if (GetAddress(i) == address)
-      return false;
-  }
+  if (GetAccountIndex(address))
+    return false;
 
   imported_accounts_[address] = std::move(hd_key);
   return true;
@@ -97,7 +95,8 @@ bool HDKeyring::RemoveImportedAccount(const std::string& address) {
 std::string HDKeyring::GetAddress(size_t index) const {
   if (accounts_.empty() || index >= accounts_.size())
     return std::string();
-  return GetAddressInternal(accounts_[index].get());
+  EnsureAccountAddressesCached();
+  return account_addresses_[index];
 }
 
 std::string HDKeyring::GetEncodedPrivateKey(const std::string& address) {
@@ -122,11 +121,19 @@ HDKeyBase* HDKeyring::GetHDKeyFromAddress(const std::string& address) {
   const auto imported_accounts_iter = imported_accounts_.find(address);
   if (imported_accounts_iter != imported_accounts_.end())
     return imported_accounts_iter->second.get();
-  for (size_t i = 0; i < accounts_.size(); ++i) {
-    if (GetAddress(i) == address)
-      return accounts_[i].get();
-  }
+  absl::optional<size_t> index = GetAccountIndex(address);
+  if (index)
+    return accounts_[*index].get();
   return nullptr;
 }
 
+void HDKeyring::EnsureAccountAddressesCached() const {
+  if (account_addresses_.size() > accounts_.size())
+    account_addresses_.resize(accounts_.size());
+  account_addresses_.reserve(accounts_.size());
+  for (size_t i = account_addresses_.size(); i < accounts_.size(); ++i) {
+    account_addresses_.push_back(GetAddressInternal(accounts_[i].get()));
+  }
+}
+
 }  // namespace brave_wallet
@@ -58,10 +58,16 @@ class HDKeyring {
   bool AddImportedAddress(const std::string& address,
                           std::unique_ptr<HDKeyBase> hd_key);
   HDKeyBase* GetHDKeyFromAddress(const std::string& address);
+  // Encodes addresses for derived accounts which haven't been memoized yet so
+  // lookups by address or index don't redo the public key derivation and
+  // keccak/base58/blake2b encoding.
+  void EnsureAccountAddressesCached() const;
 
   std::unique_ptr<HDKeyBase> root_;
   std::unique_ptr<HDKeyBase> master_key_;
   std::vector<std::unique_ptr<HDKeyBase>> accounts_;
+  // Memoized addresses of |accounts_|, index aligned and filled lazily.
+  mutable std::vector<std::string> account_addresses_;
   // (address, key)
   base::flat_map<std::string, std::unique_ptr<HDKeyBase>> imported_accounts_;
 
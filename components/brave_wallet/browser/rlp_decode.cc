@@ -169,10 +169,95 @@ bool RLPDecodeInternal(const std::string& s,
   return true;
 }
 
+// Decodes the big endian |length_size| bytes following the prefix byte of
+// |input| as a length.
+bool RLPDecodeLongLength(base::span<const uint8_t> input,
+                         size_t length_size,
+                         size_t* length) {
+  if (length_size == 0 || length_size > sizeof(size_t) ||
+      input.size() < 1 + length_size) {
+    return false;
+  }
+  // Leading zeros are not canonical
+  if (input[1] == 0)
+    return false;
+  size_t value = 0;
+  for (size_t i = 1; i <= length_size; ++i) {
+    value = (value << 8) | input[i];
+  }
+  // Lengths below 56 must use the short form
+  if (value <= 55)
+    return false;
+  *length = value;
+  return true;
+}
+
 }  // namespace
 
 namespace brave_wallet {
 
+bool RLPDecodeItem(base::span<const uint8_t> input,
+                   RLPItemView* item,
+                   base::span<const uint8_t>* remaining) {
+  if (!item || !remaining || input.empty())
+    return false;
+
+  const uint8_t prefix = input[0];
+  if (prefix <= 0x7f) {
+    item->is_list = false;
+    item->payload = input.first(1);
+    *remaining = input.subspan(1);
+    return true;
+  }
+
+  size_t header_size = 1;
+  size_t payload_size = 0;
+  bool is_list = false;
+  if (prefix <= 0xb7) {
+    payload_size = prefix - 0x80;
+  } else if (prefix <= 0xbf) {
+    if (!RLPDecodeLongLength(input, prefix - 0xb7, &payload_size))
+      return false;
+    header_size += prefix - 0xb7;
+  } else if (prefix <= 0xf7) {
+    is_list = true;
+    payload_size = prefix - 0xc0;
+  } else {
+    if (!RLPDecodeLongLength(input, prefix - 0xf7, &payload_size))
+      return false;
+    header_size += prefix - 0xf7;
+    is_list = true;
+  }
+
+  if (!IsWithinBounds(header_size, payload_size, input.size()))
+    return false;
+  base::span<const uint8_t> payload = input.subspan(header_size, payload_size);
+  // A single byte below 0x80 should have been encoded as itself.
+  if (!is_list && payload.size() == 1 && payload[0] < 0x80)
+    return false;
+
+  item->is_list = is_list;
+  item->payload = payload;
+  *remaining = input.subspan(header_size + payload_size);
+  return true;
+}
+
+bool RLPDecodeList(const RLPItemView& list, std::vector<RLPItemView>* items) {
+  if (!items || !list.is_list)
+    return false;
+  items->clear();
+  base::span<const uint8_t> input = list.payload;
+  while (!input.empty()) {
+    RLPItemView item;
+    if (!RLPDecodeItem(input, &item, &input)) {
+      items->clear();
+      return false;
+    }
+    items->push_back(item);
+  }
+  return true;
+}
+
 bool RLPDecode(const std::string& s, base::Value* output) {
   if (!output) {
     return false;
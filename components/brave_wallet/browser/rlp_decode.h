@@ -7,7 +7,9 @@
 #define BRAVE_COMPONENTS_BRAVE_WALLET_BROWSER_RLP_DECODE_H_
 
 #include <string>
+#include <vector>
 
+#include "base/containers/span.h"
 #include "base/values.h"
 
 namespace brave_wallet {
@@ -16,6 +18,23 @@ namespace brave_wallet {
 // Input string should be a hex string but without the 0x prefix
 bool RLPDecode(const std::string& s, base::Value* output);
 
+// View of a single RLP item. |payload| points into the decoded input, so the
+// input has to outlive the view.
+struct RLPItemView {
+  bool is_list = false;
+  base::span<const uint8_t> payload;
+};
+
+// Decodes the item at the front of |input| without copying anything.
+// |remaining| receives the bytes after the item. Non canonical encodings are
+// rejected.
+bool RLPDecodeItem(base::span<const uint8_t> input,
+                   RLPItemView* item,
+                   base::span<const uint8_t>* remaining);
+
+// Splits the payload of a list item into views of its direct children.
+bool RLPDecodeList(const RLPItemView& list, std::vector<RLPItemView>* items);
+
 }  // namespace brave_wallet
 
 #endif  // BRAVE_COMPONENTS_BRAVE_WALLET_BROWSER_RLP_DECODE_H_
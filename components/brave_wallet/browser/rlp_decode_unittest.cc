@@ -4,6 +4,7 @@
  * You can obtain one at http://mozilla.org/MPL/2.0/. */
 
 #include <string>
+#include <vector>
 
 #include "base/strings/string_number_conversions.h"
 #include "brave/components/brave_wallet/browser/rlp_decode.h"
@@ -393,4 +394,56 @@ TEST(RLPDecodeTest, InvalidInputLessThanLongLengthList2) {
   ASSERT_TRUE(val.is_none());
 }
 
+TEST(RLPDecodeTest, ItemViews) {
+  // ['cat', ['puppy', 'cow'], 'horse', [[]], 'pig', [''], 'sheep']
+  const std::string input = FromHex(
+      "0xe383636174ca85707570707983636f7785686f727365c1c083706967c1808573"
+      "68656570");
+  RLPItemView item;
+  base::span<const uint8_t> remaining;
+  ASSERT_TRUE(
+      RLPDecodeItem(base::as_bytes(base::make_span(input)), &item, &remaining));
+  EXPECT_TRUE(item.is_list);
+  EXPECT_TRUE(remaining.empty());
+  // Payload is a view into the input
+  EXPECT_EQ(reinterpret_cast<const char*>(item.payload.data()),
+            input.data() + 1);
+
+  std::vector<RLPItemView> items;
+  ASSERT_TRUE(RLPDecodeList(item, &items));
+  ASSERT_EQ(items.size(), 7u);
+  EXPECT_FALSE(items[0].is_list);
+  EXPECT_EQ(std::string(items[0].payload.begin(), items[0].payload.end()),
+            "cat");
+  EXPECT_TRUE(items[1].is_list);
+  std::vector<RLPItemView> children;
+  ASSERT_TRUE(RLPDecodeList(items[1], &children));
+  ASSERT_EQ(children.size(), 2u);
+  EXPECT_EQ(std::string(children[1].payload.begin(), children[1].payload.end()),
+            "cow");
+  ASSERT_TRUE(RLPDecodeList(items[5], &children));
+  ASSERT_EQ(children.size(), 1u);
+  EXPECT_TRUE(children[0].payload.empty());
+  EXPECT_FALSE(RLPDecodeList(items[6], &children));
+}
+
+TEST(RLPDecodeTest, ItemViewsInvalidInput) {
+  RLPItemView item;
+  base::span<const uint8_t> remaining;
+  for (const std::string& hex :
+       {"0x", "0x8100", "0x817F", "0x81", "0xc5010203", "0xb840ffeeddccbbaa99",
+        "0xb80100", "0xb90001ff", "0xf90180", "0xffffffffffffffffff00"}) {
+    const std::string input = FromHex(hex);
+    EXPECT_FALSE(RLPDecodeItem(base::as_bytes(base::make_span(input)), &item,
+                               &remaining))
+        << hex;
+  }
+  // Trailing bytes are handed back
+  const std::string input = FromHex("0x83646f6701");
+  ASSERT_TRUE(
+      RLPDecodeItem(base::as_bytes(base::make_span(input)), &item, &remaining));
+  ASSERT_EQ(remaining.size(), 1u);
+  EXPECT_EQ(remaining[0], 0x01);
+}
+
 }  // namespace brave_wallet
@@ -5,9 +5,13 @@
 
 #include "brave/components/brave_wallet/browser/rlp_encode.h"
 
+#include <string.h>
+
 #include <algorithm>
 #include <utility>
 
+#include "base/check_op.h"
+
 namespace {
 
 std::string RLPToBinary(size_t x) {
@@ -19,6 +23,48 @@ std::string RLPToBinary(size_t x) {
   return ret;
 }
 
+size_t RLPBinaryLength(size_t x) {
+  size_t length = 0;
+  while (x) {
+    ++length;
+    x /= 256;
+  }
+  return length;
+}
+
+size_t RLPHeaderLength(size_t payload_length) {
+  if (payload_length < 56)
+    return 1;
+  return 1 + RLPBinaryLength(payload_length);
+}
+
+size_t RLPEncodedBytesLength(base::span<const uint8_t> bytes) {
+  if (bytes.size() == 1 && bytes[0] < 0x80)
+    return 1;
+  return RLPHeaderLength(bytes.size()) + bytes.size();
+}
+
+uint8_t* RLPWriteHeader(size_t payload_length, uint8_t offset, uint8_t* out) {
+  if (payload_length < 56) {
+    *out++ = static_cast<uint8_t>(payload_length + offset);
+    return out;
+  }
+  const size_t binary_length = RLPBinaryLength(payload_length);
+  *out++ = static_cast<uint8_t>(binary_length + offset + 55);
+  for (size_t i = binary_length; i > 0; --i) {
+    *out++ = static_cast<uint8_t>(payload_length >> (8 * (i - 1)));
+  }
+  return out;
+}
+
+uint8_t* RLPWriteBytes(base::span<const uint8_t> bytes, uint8_t* out) {
+  if (!(bytes.size() == 1 && bytes[0] < 0x80))
+    out = RLPWriteHeader(bytes.size(), 0x80, out);
+  if (!bytes.empty())
+    memcpy(out, bytes.data(), bytes.size());
+  return out + bytes.size();
+}
+
 std::string RLPEncodeLength(size_t length, size_t offset) {
   char sz[2] = {0};
   if (length < 56) {
@@ -72,4 +118,80 @@ std::string RLPEncode(base::Value val) {
   return "";
 }
 
+RLPWriter::RLPWriter() = default;
+RLPWriter::~RLPWriter() = default;
+
+void RLPWriter::AddToCurrentList(size_t encoded_size) {
+  if (open_lists_.empty()) {
+    encoded_size_ += encoded_size;
+    return;
+  }
+  items_[open_lists_.back()].payload_size += encoded_size;
+}
+
+void RLPWriter::AppendBytes(base::span<const uint8_t> bytes) {
+  Item item;
+  item.type = Item::Type::kBytes;
+  item.bytes = bytes;
+  items_.push_back(item);
+  AddToCurrentList(RLPEncodedBytesLength(bytes));
+}
+
+void RLPWriter::AppendUint256(uint256_t value) {
+  Item item;
+  item.type = Item::Type::kUint;
+  size_t pos = item.uint_bytes.size();
+  while (value > static_cast<uint256_t>(0)) {
+    item.uint_bytes[--pos] =
+        static_cast<uint8_t>(value & static_cast<uint256_t>(0xFF));
+    value >>= 8;
+  }
+  item.uint_size = item.uint_bytes.size() - pos;
+  items_.push_back(item);
+  AddToCurrentList(RLPEncodedBytesLength(
+      base::make_span(item.uint_bytes).last(item.uint_size)));
+}
+
+void RLPWriter::BeginList() {
+  Item item;
+  item.type = Item::Type::kList;
+  open_lists_.push_back(items_.size());
+  items_.push_back(item);
+}
+
+void RLPWriter::EndList() {
+  DCHECK(!open_lists_.empty());
+  const size_t payload_size = items_[open_lists_.back()].payload_size;
+  open_lists_.pop_back();
+  AddToCurrentList(RLPHeaderLength(payload_size) + payload_size);
+}
+
+size_t RLPWriter::GetEncodedSize() const {
+  DCHECK(open_lists_.empty());
+  return encoded_size_;
+}
+
+void RLPWriter::Serialize(std::vector<uint8_t>* output) const {
+  DCHECK(output);
+  DCHECK(open_lists_.empty());
+  const size_t start = output->size();
+  output->resize(start + encoded_size_);
+  uint8_t* out = output->data() + start;
+  for (const auto& item : items_) {
+    switch (item.type) {
+      case Item::Type::kBytes:
+        out = RLPWriteBytes(item.bytes, out);
+        break;
+      case Item::Type::kUint:
+        out = RLPWriteBytes(
+            base::make_span(item.uint_bytes).last(item.uint_size), out);
+        break;
+      case Item::Type::kList:
+        out = RLPWriteHeader(item.payload_size, 0xc0, out);
+        break;
+    }
+  }
+  DCHECK_EQ(out, output->data() + output->size());
+}
+
 }  // namespace brave_wallet
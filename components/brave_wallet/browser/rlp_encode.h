@@ -6,8 +6,11 @@
 #ifndef BRAVE_COMPONENTS_BRAVE_WALLET_BROWSER_RLP_ENCODE_H_
 #define BRAVE_COMPONENTS_BRAVE_WALLET_BROWSER_RLP_ENCODE_H_
 
+#include <array>
 #include <string>
+#include <vector>
 
+#include "base/containers/span.h"
 #include "base/values.h"
 #include "brave/components/brave_wallet/common/brave_wallet_types.h"
 
@@ -20,6 +23,53 @@ base::Value RLPUint256ToBlobValue(uint256_t input);
 // blob, or int data
 std::string RLPEncode(base::Value val);
 
+// Streaming RLP encoder which avoids building intermediate base::Values.
+// Items are recorded in order and the length of every list is tracked as it
+// is built, so Serialize() knows the final size up front and writes the whole
+// encoding into a single preallocated buffer.
+// Byte spans passed to AppendBytes are not copied and must outlive the call to
+// Serialize().
+class RLPWriter {
+ public:
+  RLPWriter();
+  ~RLPWriter();
+  RLPWriter(const RLPWriter&) = delete;
+  RLPWriter& operator=(const RLPWriter&) = delete;
+
+  void AppendBytes(base::span<const uint8_t> bytes);
+  // Encoded as big endian bytes without leading zeros, 0 is an empty string.
+  void AppendUint256(uint256_t value);
+  void BeginList();
+  void EndList();
+
+  // Size of the encoding, only valid when all lists have been closed.
+  size_t GetEncodedSize() const;
+
+  // Appends the encoding to |output|.
+  void Serialize(std::vector<uint8_t>* output) const;
+
+ private:
+  struct Item {
+    enum class Type { kBytes, kUint, kList };
+
+    Type type = Type::kBytes;
+    base::span<const uint8_t> bytes;
+    // Big endian value of kUint items is stored in the last |uint_size|
+    // bytes.
+    std::array<uint8_t, 32> uint_bytes = {};
+    size_t uint_size = 0;
+    // Payload length of kList items.
+    size_t payload_size = 0;
+  };
+
+  void AddToCurrentList(size_t encoded_size);
+
+  std::vector<Item> items_;
+  // Indices into |items_| of the lists which are still open.
+  std::vector<size_t> open_lists_;
+  size_t encoded_size_ = 0;
+};
+
 }  // namespace brave_wallet
 
 #endif  // BRAVE_COMPONENTS_BRAVE_WALLET_BROWSER_RLP_ENCODE_H_
@@ -6,6 +6,7 @@
 #include <ctype.h>
 #include <string>
 #include <utility>
+#include <vector>
 
 #include "brave/components/brave_wallet/browser/rlp_encode.h"
 #include "brave/components/brave_wallet/common/hex_utils.h"
@@ -391,4 +392,56 @@ TEST(RLPEncodeTest, DictionaryValueNotSupported) {
   ASSERT_TRUE(brave_wallet::RLPEncode(std::move(d)).empty());
 }
 
+TEST(RLPEncodeTest, WriterMatchesValueEncoding) {
+  const std::string cat = "cat";
+  const std::string puppy = "puppy";
+  const std::string cow = "cow";
+  RLPWriter writer;
+  writer.BeginList();
+  writer.AppendBytes(base::as_bytes(base::make_span(cat)));
+  writer.BeginList();
+  writer.AppendBytes(base::as_bytes(base::make_span(puppy)));
+  writer.AppendBytes(base::as_bytes(base::make_span(cow)));
+  writer.EndList();
+  writer.BeginList();
+  writer.BeginList();
+  writer.EndList();
+  writer.EndList();
+  writer.AppendUint256(0);
+  writer.AppendUint256(15);
+  writer.AppendUint256(1024);
+  writer.EndList();
+
+  std::vector<uint8_t> output;
+  writer.Serialize(&output);
+  EXPECT_EQ(output.size(), writer.GetEncodedSize());
+  EXPECT_EQ(ToHex(output),
+            ToHex(RLPEncode(RLPTestStringToValue(
+                "['cat', ['puppy', 'cow'], [[]], '', 15, 1024]"))));
+}
+
+TEST(RLPEncodeTest, WriterLongPayloads) {
+  const std::vector<uint8_t> data(1024, 0xab);
+  RLPWriter writer;
+  writer.BeginList();
+  for (size_t i = 0; i < 100; ++i)
+    writer.AppendBytes(data);
+  writer.EndList();
+
+  std::vector<uint8_t> output = {0x02};
+  writer.Serialize(&output);
+  ASSERT_EQ(output.size(), 1 + writer.GetEncodedSize());
+  // type byte, then list header with a 3 byte length: 100 * (3 + 1024)
+  EXPECT_EQ(output[0], 0x02);
+  EXPECT_EQ(output[1], 0xfa);
+  EXPECT_EQ(output[2], 0x01);
+  EXPECT_EQ(output[3], 0x91);
+  EXPECT_EQ(output[4], 0x2c);
+  // string header with a 2 byte length: 1024
+  EXPECT_EQ(output[5], 0xb9);
+  EXPECT_EQ(output[6], 0x04);
+  EXPECT_EQ(output[7], 0x00);
+  EXPECT_EQ(output[8], 0xab);
+}
+
 }  // namespace brave_wallet
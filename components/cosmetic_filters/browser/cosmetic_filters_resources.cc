@@ -7,7 +7,6 @@
 
 #include <utility>
 
-#include "base/json/json_reader.h"
 #include "base/values.h"
 #include "brave/components/brave_shields/browser/ad_block_service.h"
 #include "brave/components/brave_shields/browser/brave_shields_util.h"
@@ -23,48 +22,17 @@ CosmeticFiltersResources::CosmeticFiltersResources(
 CosmeticFiltersResources::~CosmeticFiltersResources() {}
 
 void CosmeticFiltersResources::HiddenClassIdSelectors(
-    const std::string& input,
+    const std::vector<std::string>& classes,
+    const std::vector<std::string>& ids,
     const std::vector<std::string>& exceptions,
     HiddenClassIdSelectorsCallback callback) {
   DCHECK(ad_block_service_->GetTaskRunner()->RunsTasksInCurrentSequence());
-  absl::optional<base::Value> input_value = base::JSONReader::Read(input);
-  if (!input_value || !input_value->is_dict()) {
-    // Nothing to work with
-    std::move(callback).Run(base::Value());
+  auto result = mojom::HiddenClassIdSelectorsResult::New();
+  ad_block_service_->HiddenClassIdSelectors(classes, ids, exceptions,
+                                            &result->hide_selectors,
+                                            &result->force_hide_selectors);
 
-    return;
-  }
-  base::DictionaryValue* input_dict;
-  if (!input_value->GetAsDictionary(&input_dict)) {
-    std::move(callback).Run(base::Value());
-
-    return;
-  }
-  std::vector<std::string> classes;
-  base::ListValue* classes_list;
-  if (input_dict->GetList("classes", &classes_list)) {
-    for (const auto& class_item : classes_list->GetList()) {
-      if (!class_item.is_string()) {
-        continue;
-      }
-      classes.push_back(class_item.GetString());
-    }
-  }
-  std::vector<std::string> ids;
-  base::ListValue* ids_list;
-  if (input_dict->GetList("ids", &ids_list)) {
-    for (const auto& id_item : ids_list->GetList()) {
-      if (!id_item.is_string()) {
-        continue;
-      }
-      ids.push_back(id_item.GetString());
-    }
-  }
-
-  auto selectors =
-      ad_block_service_->HiddenClassIdSelectors(classes, ids, exceptions);
-
-  std::move(callback).Run(std::move(selectors));
+  std::move(callback).Run(std::move(result));
 }
 
 void CosmeticFiltersResources::UrlCosmeticResources(
@@ -9,6 +9,7 @@
 
 #include "base/bind.h"
 #include "base/json/json_writer.h"
+#include "base/json/string_escape.h"
 #include "base/metrics/histogram_macros.h"
 #include "base/no_destructor.h"
 #include "base/strings/stringprintf.h"
@@ -141,12 +142,13 @@ CosmeticFiltersJSHandler::CosmeticFiltersJSHandler(
 CosmeticFiltersJSHandler::~CosmeticFiltersJSHandler() = default;
 
 void CosmeticFiltersJSHandler::HiddenClassIdSelectors(
-    const std::string& input) {
+    const std::vector<std::string>& classes,
+    const std::vector<std::string>& ids) {
   if (!EnsureConnected())
     return;
 
   cosmetic_filters_resources_->HiddenClassIdSelectors(
-      input, exceptions_,
+      classes, ids, exceptions_,
       base::BindOnce(&CosmeticFiltersJSHandler::OnHiddenClassIdSelectors,
                      base::Unretained(this)));
 }
@@ -441,25 +443,19 @@ void CosmeticFiltersJSHandler::CSSRulesRoutine(
     ExecuteObservingBundleEntryPoint();
 }
 
-void CosmeticFiltersJSHandler::OnHiddenClassIdSelectors(base::Value result) {
+void CosmeticFiltersJSHandler::OnHiddenClassIdSelectors(
+    mojom::HiddenClassIdSelectorsResultPtr result) {
   if (generichide_) {
     return;
   }
 
-  DCHECK(result.is_dict());
+  DCHECK(result);
+  const std::vector<std::string>& hide_selectors = result->hide_selectors;
 
-  base::Value* hide_selectors = result.FindListKey("hide_selectors");
-  DCHECK(hide_selectors);
-
-  base::Value* force_hide_selectors =
-      result.FindListKey("force_hide_selectors");
-  DCHECK(force_hide_selectors);
-
-  if (force_hide_selectors->GetList().size() != 0) {
+  if (!result->force_hide_selectors.empty()) {
     std::string stylesheet = "";
-    for (auto& selector : force_hide_selectors->GetList()) {
-      DCHECK(selector.is_string());
-      stylesheet += selector.GetString() + "{display:none !important}";
+    for (const auto& selector : result->force_hide_selectors) {
+      stylesheet += selector + "{display:none !important}";
     }
     InjectStylesheet(stylesheet, 0);
   }
@@ -470,15 +466,18 @@ void CosmeticFiltersJSHandler::OnHiddenClassIdSelectors(base::Value result) {
     return;
 
   blink::WebLocalFrame* web_frame = render_frame_->GetWebFrame();
-  std::string json_selectors;
-  if (!base::JSONWriter::Write(*hide_selectors, &json_selectors) ||
-      json_selectors.empty()) {
-    json_selectors = "[]";
+  std::string json_selectors = "[";
+  for (size_t i = 0; i < hide_selectors.size(); ++i) {
+    if (i > 0)
+      json_selectors += ",";
+    base::EscapeJSONString(hide_selectors[i], /*put_in_quotes=*/true,
+                           &json_selectors);
   }
+  json_selectors += "]";
   // Building a script for stylesheet modifications
   std::string new_selectors_script =
       base::StringPrintf(kHideSelectorsInjectScript, json_selectors.c_str());
-  if (hide_selectors->GetList().size() != 0) {
+  if (!hide_selectors.empty()) {
     web_frame->ExecuteScriptInIsolatedWorld(
         isolated_world_id_,
         blink::WebScriptSource(
@@ -61,12 +61,13 @@ class CosmeticFiltersJSHandler {
   void CreateWorkerObject(v8::Isolate* isolate, v8::Local<v8::Context> context);
 
   // A function to be called from JS
-  void HiddenClassIdSelectors(const std::string& input);
+  void HiddenClassIdSelectors(const std::vector<std::string>& classes,
+                              const std::vector<std::string>& ids);
 
   void OnUrlCosmeticResources(base::OnceClosure callback,
                               base::Value result);
   void CSSRulesRoutine(base::DictionaryValue* resources_dict);
-  void OnHiddenClassIdSelectors(base::Value result);
+  void OnHiddenClassIdSelectors(mojom::HiddenClassIdSelectorsResultPtr result);
   bool OnIsFirstParty(const std::string& url_string);
 
   void InjectStylesheet(const std::string& stylesheet, int id);
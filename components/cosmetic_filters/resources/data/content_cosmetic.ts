@@ -98,14 +98,26 @@ const fetchNewClassIdRules = () => {
   }
   // Callback to c++ renderer process
   // @ts-expect-error
-  cf_worker.hiddenClassIdSelectors(
-      JSON.stringify({
-        classes: notYetQueriedClasses, ids: notYetQueriedIds
-      }))
+  cf_worker.hiddenClassIdSelectors(notYetQueriedClasses, notYetQueriedIds)
   notYetQueriedClasses = []
   notYetQueriedIds = []
 }
 
+let fetchNewClassIdRulesScheduled = false
+
+// MutationObserver callbacks can fire many times per frame on DOM-heavy pages;
+// coalesce them into a single query per animation frame.
+const scheduleFetchNewClassIdRules = () => {
+  if (fetchNewClassIdRulesScheduled) {
+    return
+  }
+  fetchNewClassIdRulesScheduled = true
+  window.requestAnimationFrame(() => {
+    fetchNewClassIdRulesScheduled = false
+    fetchNewClassIdRules()
+  })
+}
+
 const handleMutations: MutationCallback = (mutations: MutationRecord[]) => {
   for (const aMutation of mutations) {
     if (aMutation.type === 'attributes') {
@@ -154,7 +166,7 @@ const handleMutations: MutationCallback = (mutations: MutationRecord[]) => {
     }
   }
 
-  fetchNewClassIdRules()
+  scheduleFetchNewClassIdRules()
 }
 
 const isFirstPartyUrl = (url: string): boolean => {
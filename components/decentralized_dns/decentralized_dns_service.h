@@ -8,6 +8,7 @@
 
 #include <memory>
 
+#include "brave/components/decentralized_dns/resolution_cache.h"
 #include "components/keyed_service/core/keyed_service.h"
 
 namespace content {
@@ -35,9 +36,14 @@ class DecentralizedDnsService : public KeyedService {
 
   static void RegisterLocalStatePrefs(PrefRegistrySimple* registry);
 
+  // Shared by every lookup of decentralized DNS names in this context.
+  ResolutionCache* resolution_cache() { return &resolution_cache_; }
+
  private:
   void OnPreferenceChanged();
 
+  ResolutionCache resolution_cache_;
+
   std::unique_ptr<PrefChangeRegistrar> pref_change_registrar_;
   std::unique_ptr<DecentralizedDnsServiceDelegate> delegate_;
 };
@@ -0,0 +1,92 @@
+/* Copyright (c) 2022 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/decentralized_dns/resolution_cache.h"
+
+#include <utility>
+
+#include "base/bind.h"
+#include "base/check.h"
+#include "base/time/default_tick_clock.h"
+#include "base/time/tick_clock.h"
+
+namespace decentralized_dns {
+
+ResolutionCache::ResolutionCache()
+    : ResolutionCache(base::DefaultTickClock::GetInstance()) {}
+
+ResolutionCache::ResolutionCache(const base::TickClock* tick_clock)
+    : tick_clock_(tick_clock), entries_(kMaxEntries) {}
+
+ResolutionCache::~ResolutionCache() = default;
+
+bool ResolutionCache::GetCached(const std::string& host,
+                                bool* success,
+                                Records* records) {
+  DCHECK(success);
+  DCHECK(records);
+  auto entry = entries_.Get(host);
+  if (entry == entries_.end())
+    return false;
+
+  if (entry->second.expiration <= tick_clock_->NowTicks()) {
+    entries_.Erase(entry);
+    return false;
+  }
+
+  *success = entry->second.success;
+  *records = entry->second.records;
+  return true;
+}
+
+void ResolutionCache::Resolve(const std::string& host,
+                              ResolveFunction resolve,
+                              ResolveCallback callback) {
+  bool success = false;
+  Records records;
+  if (GetCached(host, &success, &records)) {
+    std::move(callback).Run(success, records);
+    return;
+  }
+
+  const auto key = std::make_pair(generation_, host);
+  auto pending = pending_.find(key);
+  if (pending != pending_.end()) {
+    pending->second.push_back(std::move(callback));
+    return;
+  }
+
+  pending_[key].push_back(std::move(callback));
+  std::move(resolve).Run(base::BindOnce(&ResolutionCache::OnResolved,
+                                        weak_ptr_factory_.GetWeakPtr(), host,
+                                        generation_));
+}
+
+void ResolutionCache::Clear() {
+  entries_.Clear();
+  ++generation_;
+}
+
+void ResolutionCache::OnResolved(const std::string& host,
+                                 int generation,
+                                 bool success,
+                                 const Records& records) {
+  if (generation == generation_) {
+    entries_.Put(host,
+                 Entry{success, records,
+                       tick_clock_->NowTicks() +
+                           (success ? kTTL : kNegativeTTL)});
+  }
+
+  auto pending = pending_.find(std::make_pair(generation, host));
+  if (pending == pending_.end())
+    return;
+  std::vector<ResolveCallback> callbacks = std::move(pending->second);
+  pending_.erase(pending);
+  for (auto& callback : callbacks)
+    std::move(callback).Run(success, records);
+}
+
+}  // namespace decentralized_dns
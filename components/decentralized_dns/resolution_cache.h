@@ -0,0 +1,89 @@
+/* Copyright (c) 2022 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#ifndef BRAVE_COMPONENTS_DECENTRALIZED_DNS_RESOLUTION_CACHE_H_
+#define BRAVE_COMPONENTS_DECENTRALIZED_DNS_RESOLUTION_CACHE_H_
+
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "base/callback.h"
+#include "base/containers/flat_map.h"
+#include "base/containers/lru_cache.h"
+#include "base/memory/raw_ptr.h"
+#include "base/memory/weak_ptr.h"
+#include "base/time/time.h"
+
+namespace base {
+class TickClock;
+}  // namespace base
+
+namespace decentralized_dns {
+
+// Caches decentralized DNS resolutions (ENS content hashes, Unstoppable
+// Domains records) by host, so that every subresource of a dweb page doesn't
+// pay for its own round of mainnet RPCs. Failed lookups are cached for a
+// shorter time, and concurrent lookups for the same host share one resolve.
+class ResolutionCache {
+ public:
+  using Records = std::vector<std::string>;
+  using ResolveCallback =
+      base::OnceCallback<void(bool success, const Records& records)>;
+  // Performs the actual lookup and runs the callback with its result.
+  using ResolveFunction = base::OnceCallback<void(ResolveCallback)>;
+
+  static constexpr base::TimeDelta kTTL = base::Minutes(5);
+  static constexpr base::TimeDelta kNegativeTTL = base::Seconds(30);
+  static constexpr size_t kMaxEntries = 256;
+
+  ResolutionCache();
+  explicit ResolutionCache(const base::TickClock* tick_clock);
+  ResolutionCache(const ResolutionCache&) = delete;
+  ResolutionCache& operator=(const ResolutionCache&) = delete;
+  ~ResolutionCache();
+
+  // Returns true and fills |success| and |records| if there is a fresh cached
+  // result for |host|.
+  bool GetCached(const std::string& host, bool* success, Records* records);
+
+  // Runs |callback| with the cached result for |host| if there is a fresh
+  // one, joins the in-flight lookup for |host| if there is one, and otherwise
+  // runs |resolve| synchronously to start a new lookup.
+  void Resolve(const std::string& host,
+               ResolveFunction resolve,
+               ResolveCallback callback);
+
+  // Drops all cached results, e.g. when the resolve method changes. Lookups
+  // already in flight still complete for the callers waiting on them, but
+  // their results aren't cached and later callers start a new lookup.
+  void Clear();
+
+ private:
+  struct Entry {
+    bool success = false;
+    Records records;
+    base::TimeTicks expiration;
+  };
+
+  void OnResolved(const std::string& host,
+                  int generation,
+                  bool success,
+                  const Records& records);
+
+  raw_ptr<const base::TickClock> tick_clock_;
+  base::LRUCache<std::string, Entry> entries_;
+  // Callers waiting on an in-flight lookup, by the generation the lookup was
+  // started in and host.
+  base::flat_map<std::pair<int, std::string>, std::vector<ResolveCallback>>
+      pending_;
+  int generation_ = 0;
+
+  base::WeakPtrFactory<ResolutionCache> weak_ptr_factory_{this};
+};
+
+}  // namespace decentralized_dns
+
+#endif  // BRAVE_COMPONENTS_DECENTRALIZED_DNS_RESOLUTION_CACHE_H_
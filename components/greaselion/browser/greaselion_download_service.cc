@@ -5,17 +5,21 @@
 
 #include "brave/components/greaselion/browser/greaselion_download_service.h"
 
+#include <algorithm>
 #include <memory>
 #include <utility>
 
 #include "base/base_paths.h"
 #include "base/bind.h"
 #include "base/command_line.h"
+#include "base/files/file_enumerator.h"
 #include "base/files/file_path_watcher.h"
 #include "base/files/file_util.h"
 #include "base/json/json_reader.h"
+#include "base/json/json_writer.h"
 #include "base/logging.h"
-#include "base/strings/stringprintf.h"
+#include "base/strings/string_number_conversions.h"
+#include "base/strings/string_util.h"
 #include "base/strings/utf_string_conversions.h"
 #include "base/task/post_task.h"
 #include "base/task/task_runner_util.h"
@@ -25,6 +29,8 @@
 #include "brave/components/brave_component_updater/browser/dat_file_util.h"
 #include "brave/components/brave_component_updater/browser/local_data_files_service.h"
 #include "brave/components/greaselion/browser/switches.h"
+#include "crypto/secure_hash.h"
+#include "crypto/sha2.h"
 
 using brave_component_updater::LocalDataFilesObserver;
 using brave_component_updater::LocalDataFilesService;
@@ -48,7 +54,9 @@ namespace greaselion {
 
 const char kGreaselionConfigFile[] = "Greaselion.json";
 const char kGreaselionConfigFileVersion[] = "1";
-const char kRuleNameFormat[] = "greaselion-%zu";
+const char kRuleNamePrefix[] = "greaselion-";
+// Number of content hash bytes that go into a rule name.
+constexpr size_t kRuleNameHashBytes = 8;
 // Greaselion.json keys
 const char kPreconditions[] = "preconditions";
 const char kURLs[] = "urls";
@@ -68,7 +76,7 @@ const char kAds[] = "ads-enabled";
 const char kSupportsMinimumBraveVersion[] =
     "supports-minimum-brave-version";
 
-GreaselionRule::GreaselionRule(const std::string& name) : name_(name) {}
+GreaselionRule::GreaselionRule() = default;
 
 GreaselionRule::GreaselionRule(const GreaselionRule& name) = default;
 
@@ -141,6 +149,46 @@ void GreaselionRule::Parse(base::DictionaryValue* preconditions_value,
   }
 }
 
+void GreaselionRule::ComputeContentHash(const base::Value& rule_value) {
+  std::unique_ptr<crypto::SecureHash> hash =
+      crypto::SecureHash::Create(crypto::SecureHash::SHA256);
+  // Script and message paths in the rule are relative to the component
+  // directory, so the serialized rule does not change with the component
+  // version.
+  std::string serialized_rule;
+  base::JSONWriter::Write(rule_value, &serialized_rule);
+  hash->Update(serialized_rule.data(), serialized_rule.size());
+  for (const auto& script : scripts_) {
+    std::string contents;
+    if (!base::ReadFileToString(script, &contents))
+      LOG(ERROR) << "Could not read Greaselion script for hashing";
+    hash->Update(contents.data(), contents.size());
+  }
+  if (!messages_.empty()) {
+    std::vector<base::FilePath> message_files;
+    base::FileEnumerator enumerator(messages_, true,
+                                    base::FileEnumerator::FILES);
+    for (base::FilePath path = enumerator.Next(); !path.empty();
+         path = enumerator.Next()) {
+      message_files.push_back(path);
+    }
+    std::sort(message_files.begin(), message_files.end());
+    for (const auto& path : message_files) {
+      base::FilePath relative_path;
+      messages_.AppendRelativePath(path, &relative_path);
+      const std::string relative_path_string = relative_path.AsUTF8Unsafe();
+      hash->Update(relative_path_string.data(), relative_path_string.size());
+      std::string contents;
+      base::ReadFileToString(path, &contents);
+      hash->Update(contents.data(), contents.size());
+    }
+  }
+  uint8_t digest[crypto::kSHA256Length];
+  hash->Finish(digest, sizeof(digest));
+  content_hash_ = base::ToLowerASCII(base::HexEncode(digest, sizeof(digest)));
+  name_ = kRuleNamePrefix + content_hash_.substr(0, kRuleNameHashBytes * 2);
+}
+
 GreaselionRule::~GreaselionRule() = default;
 
 bool GreaselionRule::PreconditionFulfilled(
@@ -192,6 +240,62 @@ bool GreaselionRule::Matches(
   return true;
 }
 
+namespace {
+
+// Reads and parses the Greaselion configuration, including hashing the files
+// every rule references. Returns absl::nullopt if the configuration could not
+// be loaded.
+//
+// NOTE: This function does file IO and should not be called on the UI thread.
+absl::optional<std::vector<std::unique_ptr<GreaselionRule>>>
+ParseRulesOnTaskRunner(const base::FilePath& dat_file_path,
+                       const base::FilePath& resource_dir) {
+  std::string contents =
+      brave_component_updater::GetDATFileAsString(dat_file_path);
+  if (contents.empty()) {
+    LOG(ERROR) << "Could not obtain Greaselion configuration";
+    return absl::nullopt;
+  }
+  absl::optional<base::Value> root = base::JSONReader::Read(contents);
+  if (!root) {
+    LOG(ERROR) << "Failed to parse Greaselion configuration";
+    return absl::nullopt;
+  }
+  std::vector<std::unique_ptr<GreaselionRule>> rules;
+  base::ListValue* root_list = nullptr;
+  root->GetAsList(&root_list);
+  for (base::Value& rule_it : root_list->GetList()) {
+    base::DictionaryValue* rule_dict = nullptr;
+    rule_it.GetAsDictionary(&rule_dict);
+    base::DictionaryValue* preconditions_value = nullptr;
+    rule_dict->GetDictionary(kPreconditions, &preconditions_value);
+    base::ListValue* urls_value = nullptr;
+    rule_dict->GetList(kURLs, &urls_value);
+    base::ListValue* scripts_value = nullptr;
+    rule_dict->GetList(kScripts, &scripts_value);
+    const std::string* run_at_ptr = rule_it.FindStringPath(kRunAt);
+    const std::string run_at_value = run_at_ptr ? *run_at_ptr : "";
+    const std::string* minimum_brave_version_ptr = rule_it.FindStringPath(
+        kMinimumBraveVersion);
+    const std::string minimum_brave_version_value =
+        minimum_brave_version_ptr ? *minimum_brave_version_ptr : "";
+    const std::string* messages = rule_it.FindStringPath(kMessages);
+    base::FilePath messages_path;
+    if (messages) {
+      messages_path = base::FilePath::FromUTF8Unsafe(messages->c_str());
+    }
+
+    std::unique_ptr<GreaselionRule> rule = std::make_unique<GreaselionRule>();
+    rule->Parse(preconditions_value, urls_value, scripts_value, run_at_value,
+        minimum_brave_version_value, messages_path, resource_dir);
+    rule->ComputeContentHash(rule_it);
+    rules.push_back(std::move(rule));
+  }
+  return rules;
+}
+
+}  // namespace
+
 GreaselionDownloadService::GreaselionDownloadService(
     LocalDataFilesService* local_data_files_service)
     : LocalDataFilesObserver(local_data_files_service), weak_factory_(this) {
@@ -268,53 +372,18 @@ void GreaselionDownloadService::LoadDirectlyFromResourcePath() {
       resource_dir_.AppendASCII(kGreaselionConfigFile);
   base::PostTaskAndReplyWithResult(
       GetTaskRunner().get(), FROM_HERE,
-      base::BindOnce(&brave_component_updater::GetDATFileAsString,
-                     dat_file_path),
-      base::BindOnce(&GreaselionDownloadService::OnDATFileDataReady,
+      base::BindOnce(&ParseRulesOnTaskRunner, dat_file_path, resource_dir_),
+      base::BindOnce(&GreaselionDownloadService::OnRulesParsed,
                      weak_factory_.GetWeakPtr()));
 }
 
-void GreaselionDownloadService::OnDATFileDataReady(std::string contents) {
+void GreaselionDownloadService::OnRulesParsed(
+    absl::optional<std::vector<std::unique_ptr<GreaselionRule>>> rules) {
   DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
   rules_.clear();
-  if (contents.empty()) {
-    LOG(ERROR) << "Could not obtain Greaselion configuration";
+  if (!rules)
     return;
-  }
-  absl::optional<base::Value> root = base::JSONReader::Read(contents);
-  if (!root) {
-    LOG(ERROR) << "Failed to parse Greaselion configuration";
-    return;
-  }
-  base::ListValue* root_list = nullptr;
-  root->GetAsList(&root_list);
-  for (base::Value& rule_it : root_list->GetList()) {
-    base::DictionaryValue* rule_dict = nullptr;
-    rule_it.GetAsDictionary(&rule_dict);
-    base::DictionaryValue* preconditions_value = nullptr;
-    rule_dict->GetDictionary(kPreconditions, &preconditions_value);
-    base::ListValue* urls_value = nullptr;
-    rule_dict->GetList(kURLs, &urls_value);
-    base::ListValue* scripts_value = nullptr;
-    rule_dict->GetList(kScripts, &scripts_value);
-    const std::string* run_at_ptr = rule_it.FindStringPath(kRunAt);
-    const std::string run_at_value = run_at_ptr ? *run_at_ptr : "";
-    const std::string* minimum_brave_version_ptr = rule_it.FindStringPath(
-        kMinimumBraveVersion);
-    const std::string minimum_brave_version_value =
-        minimum_brave_version_ptr ? *minimum_brave_version_ptr : "";
-    const std::string* messages = rule_it.FindStringPath(kMessages);
-    base::FilePath messages_path;
-    if (messages) {
-      messages_path = base::FilePath::FromUTF8Unsafe(messages->c_str());
-    }
-
-    std::unique_ptr<GreaselionRule> rule = std::make_unique<GreaselionRule>(
-        base::StringPrintf(kRuleNameFormat, rules_.size()));
-    rule->Parse(preconditions_value, urls_value, scripts_value, run_at_value,
-        minimum_brave_version_value, messages_path, resource_dir_);
-    rules_.push_back(std::move(rule));
-  }
+  rules_ = std::move(*rules);
   for (Observer& observer : observers_)
     observer.OnRulesReady(this);
 }
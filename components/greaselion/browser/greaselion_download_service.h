@@ -22,6 +22,7 @@
 #include "brave/components/greaselion/browser/greaselion_service.h"
 #include "content/public/browser/notification_types.h"
 #include "extensions/common/url_pattern_set.h"
+#include "third_party/abseil-cpp/absl/types/optional.h"
 #include "url/gurl.h"
 
 class GreaselionServiceTest;
@@ -52,7 +53,7 @@ struct GreaselionPreconditions {
 
 class GreaselionRule {
  public:
-  explicit GreaselionRule(const std::string& name);
+  GreaselionRule();
   explicit GreaselionRule(const GreaselionRule& name);
   GreaselionRule& operator=(const GreaselionRule& name);
   ~GreaselionRule();
@@ -64,9 +65,17 @@ class GreaselionRule {
              const std::string& minimum_brave_version_value,
              const base::FilePath& messages_value,
              const base::FilePath& resource_dir);
+  // Hashes the rule entry together with the scripts and messages it
+  // references, and names the rule after the result so that an unchanged rule
+  // keeps the same extension id across component updates.
+  //
+  // NOTE: This function does file IO and should not be called on the UI
+  // thread.
+  void ComputeContentHash(const base::Value& rule_value);
   bool Matches(
       GreaselionFeatures state, const base::Version& browser_version) const;
   std::string name() const { return name_; }
+  const std::string& content_hash() const { return content_hash_; }
   std::vector<std::string> url_patterns() const { return url_patterns_; }
   std::vector<base::FilePath> scripts() const { return scripts_; }
   std::string run_at() const {
@@ -84,6 +93,7 @@ class GreaselionRule {
                              bool value) const;
 
   std::string name_;
+  std::string content_hash_;
   std::vector<std::string> url_patterns_;
   std::vector<base::FilePath> scripts_;
   std::string run_at_;
@@ -126,7 +136,8 @@ class GreaselionDownloadService : public LocalDataFilesObserver {
  private:
   friend class ::GreaselionServiceTest;
 
-  void OnDATFileDataReady(std::string contents);
+  void OnRulesParsed(
+      absl::optional<std::vector<std::unique_ptr<GreaselionRule>>> rules);
   void OnDevModeLocalFileChanged(bool error);
   void LoadOnTaskRunner();
   void LoadDirectlyFromResourcePath();
@@ -15,6 +15,8 @@
 #include "base/bind.h"
 #include "base/callback_helpers.h"
 #include "base/command_line.h"
+#include "base/containers/contains.h"
+#include "base/containers/flat_set.h"
 #include "base/feature_list.h"
 #include "base/files/file_path.h"
 #include "base/files/file_util.h"
@@ -270,61 +272,82 @@ void GreaselionServiceImpl::UpdateInstalledExtensions() {
     return;
   }
   update_in_progress_ = true;
-  if (greaselion_extensions_.empty()) {
-    // No Greaselion extensions are currently installed, so we can move on to
-    // the install phase immediately.
+
+  // Only extensions whose rule no longer applies, or whose rule content
+  // changed, need to go. Everything else stays installed as is.
+  base::flat_set<std::string> active_rules;
+  for (const std::unique_ptr<GreaselionRule>& rule :
+       *download_service_->rules()) {
+    if (ShouldInstallRule(*rule))
+      active_rules.insert(rule->content_hash());
+  }
+  std::vector<extensions::ExtensionId> stale_extensions;
+  for (const auto& rule_extension : rule_extensions_) {
+    if (!base::Contains(active_rules, rule_extension.first))
+      stale_extensions.push_back(rule_extension.second);
+  }
+  if (stale_extensions.empty()) {
+    // Nothing to unload, so we can move on to the install phase immediately.
     CreateAndInstallExtensions();
     return;
   }
 
-  // Make a copy of greaselion_extensions_ to iterate while the original vector
-  // changes.
-  std::vector<extensions::ExtensionId> extensions = greaselion_extensions_;
-  for (auto id : extensions) {
-    // We need to unload all the Greaselion extensions that are already
-    // installed. OnExtensionUnloaded will be called on each extension, where we
-    // will update the greaselion_extensions_ set. Once it's empty, that
-    // callback will call CreateAndInstallExtensions().
+  pending_unloads_ = stale_extensions;
+  for (const auto& id : stale_extensions) {
+    // OnExtensionUnloaded will be called on each extension, where we will
+    // update pending_unloads_. Once it's empty, that callback will call
+    // CreateAndInstallExtensions().
     extension_service_->UnloadExtension(
         id, extensions::UnloadedExtensionReason::UPDATE);
   }
 }
 
+bool GreaselionServiceImpl::ShouldInstallRule(
+    const GreaselionRule& rule) const {
+  return rule.Matches(state_, browser_version_) &&
+         rule.has_unknown_preconditions() == false;
+}
+
 void GreaselionServiceImpl::CreateAndInstallExtensions() {
-  DCHECK(greaselion_extensions_.empty());
+  DCHECK(pending_unloads_.empty());
   DCHECK(update_in_progress_);
   all_rules_installed_successfully_ = true;
   pending_installs_ = 0;
-  std::vector<std::unique_ptr<GreaselionRule>>* rules =
-      download_service_->rules();
-  for (const std::unique_ptr<GreaselionRule>& rule : *rules) {
-    if (rule->Matches(state_, browser_version_) &&
-        rule->has_unknown_preconditions() == false) {
-      pending_installs_ += 1;
+  std::vector<const GreaselionRule*> rules_to_install;
+  base::flat_set<std::string> seen_rules;
+  for (const std::unique_ptr<GreaselionRule>& rule :
+       *download_service_->rules()) {
+    if (!ShouldInstallRule(*rule))
+      continue;
+    // Skip rules that are already installed, and duplicates of a rule, which
+    // would convert to the same extension id.
+    if (base::Contains(rule_extensions_, rule->content_hash()) ||
+        !seen_rules.insert(rule->content_hash()).second) {
+      continue;
     }
+    rules_to_install.push_back(rule.get());
   }
+  pending_installs_ = static_cast<int>(rules_to_install.size());
   if (!pending_installs_) {
-    // no rules match, nothing else to do
+    // no rules changed, nothing else to do
     MaybeNotifyObservers();
     return;
   }
-  for (const std::unique_ptr<GreaselionRule>& rule : *rules) {
-    if (rule->Matches(state_, browser_version_) &&
-        rule->has_unknown_preconditions() == false) {
-      // Convert script file to component extension. This must run on extension
-      // file task runner, which was passed in in the constructor.
-      GreaselionRule rule_copy(*rule);
-      base::PostTaskAndReplyWithResult(
-          task_runner_.get(), FROM_HERE,
-          base::BindOnce(&ConvertGreaselionRuleToExtensionOnTaskRunner,
-                         rule_copy, install_directory_),
-          base::BindOnce(&GreaselionServiceImpl::PostConvert,
-                         weak_factory_.GetWeakPtr()));
-    }
+  for (const GreaselionRule* rule : rules_to_install) {
+    // Convert script file to component extension. This must run on extension
+    // file task runner, which was passed in in the constructor.
+    GreaselionRule rule_copy(*rule);
+    base::PostTaskAndReplyWithResult(
+        task_runner_.get(), FROM_HERE,
+        base::BindOnce(&ConvertGreaselionRuleToExtensionOnTaskRunner,
+                       rule_copy, install_directory_),
+        base::BindOnce(&GreaselionServiceImpl::PostConvert,
+                       weak_factory_.GetWeakPtr(), rule->content_hash()));
   }
 }
 
 void GreaselionServiceImpl::PostConvert(
+    const std::string& content_hash,
     absl::optional<GreaselionConvertedExtension> converted_extension) {
   if (!converted_extension) {
     all_rules_installed_successfully_ = false;
@@ -333,6 +356,7 @@ void GreaselionServiceImpl::PostConvert(
     LOG(ERROR) << "Could not load Greaselion script";
   } else {
     greaselion_extensions_.push_back(converted_extension->first->id());
+    rule_extensions_[content_hash] = converted_extension->first->id();
     extension_dirs_.push_back(converted_extension->second);
     extension_system_->ready().Post(
         FROM_HERE, base::BindOnce(&GreaselionServiceImpl::Install,
@@ -371,7 +395,15 @@ void GreaselionServiceImpl::OnExtensionUnloaded(
     return;
   }
   greaselion_extensions_.erase(index);
-  if (update_in_progress_ && greaselion_extensions_.empty()) {
+  base::EraseIf(rule_extensions_, [extension](const auto& rule_extension) {
+    return rule_extension.second == extension->id();
+  });
+  auto pending_unload = std::find(pending_unloads_.begin(),
+                                  pending_unloads_.end(), extension->id());
+  if (pending_unload == pending_unloads_.end())
+    return;
+  pending_unloads_.erase(pending_unload);
+  if (update_in_progress_ && pending_unloads_.empty()) {
     // It's time!
     CreateAndInstallExtensions();
   }
@@ -11,6 +11,7 @@
 #include <utility>
 #include <vector>
 
+#include "base/containers/flat_map.h"
 #include "base/files/file_path.h"
 #include "base/memory/raw_ptr.h"
 #include "base/memory/weak_ptr.h"
@@ -73,8 +74,10 @@ class GreaselionServiceImpl : public GreaselionService,
 
  private:
   void SetBrowserVersionForTesting(const base::Version& version) override;
+  bool ShouldInstallRule(const GreaselionRule& rule) const;
   void CreateAndInstallExtensions();
   void PostConvert(
+      const std::string& content_hash,
       absl::optional<GreaselionConvertedExtension> converted_extension);
   void Install(scoped_refptr<extensions::Extension> extension);
   void MaybeNotifyObservers();
@@ -98,6 +101,10 @@ class GreaselionServiceImpl : public GreaselionService,
   scoped_refptr<base::SequencedTaskRunner> task_runner_;
   base::ObserverList<GreaselionService::Observer> observers_;
   std::vector<extensions::ExtensionId> greaselion_extensions_;
+  // Installed extensions keyed by the content hash of the rule they were
+  // converted from.
+  base::flat_map<std::string, extensions::ExtensionId> rule_extensions_;
+  std::vector<extensions::ExtensionId> pending_unloads_;
   std::vector<base::FilePath> extension_dirs_;
   base::Version browser_version_;
   base::WeakPtrFactory<GreaselionServiceImpl> weak_factory_;
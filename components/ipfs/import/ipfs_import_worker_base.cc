@@ -88,17 +88,15 @@ void IpfsImportWorkerBase::ImportFile(const base::FilePath upload_file_path,
   base::ThreadPool::PostTaskAndReplyWithResult(
       FROM_HERE, {base::MayBlock()},
       base::BindOnce(&ipfs::CalculateFileSize, upload_file_path),
-      base::BindOnce(&CreateRequestForFile, upload_file_path,
-                     blob_context_getter_factory_, mime_type, filename,
-                     std::move(upload_callback)));
+      base::BindOnce(&CreateRequestForFile, upload_file_path, mime_type,
+                     filename, std::move(upload_callback)));
 }
 
 void IpfsImportWorkerBase::ImportFolder(const base::FilePath folder_path) {
   auto upload_callback = base::BindOnce(&IpfsImportWorkerBase::UploadData,
                                         weak_factory_.GetWeakPtr());
   data_->filename = folder_path.BaseName().MaybeAsASCII();
-  CreateRequestForFolder(folder_path, blob_context_getter_factory_,
-                         std::move(upload_callback));
+  CreateRequestForFolder(folder_path, std::move(upload_callback));
 }
 
 void IpfsImportWorkerBase::ImportText(const std::string& text,
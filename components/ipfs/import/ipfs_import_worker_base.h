@@ -34,12 +34,14 @@ namespace ipfs {
 // A base class that implements steps for importing objects into ipfs.
 // In order to import an object it is necessary to create
 // an ImportWorker of the desired type, each worker can import only one object.
-// The worker must be deleted when the import is completed.
+// The worker must be deleted when the import is completed, deleting it earlier
+// cancels the import, including an upload in progress.
 // The import process consists of the following steps:
 // Worker:
-//   1. Worker prepares a blob block of data to import
+//   1. Worker prepares the request body to import, files are streamed from
+//      disk
 // IpfsImportWorkerBase:
-//   2. Sends blob to ifps using IPFS api (/api/v0/add)
+//   2. Uploads the body to IPFS using IPFS api (/api/v0/add)
 //   3. Creates target directory for import using IPFS api(/api/v0/files/mkdir)
 //   4. Moves objects to target directory using IPFS api(/api/v0/files/cp)
 //   5. Publishes objects under passed IPNS key(/api/v0/name/publish)
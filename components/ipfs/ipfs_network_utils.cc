@@ -23,6 +23,7 @@
 #include "content/public/browser/browser_task_traits.h"
 #include "net/base/mime_util.h"
 #include "services/network/public/cpp/resource_request.h"
+#include "services/network/public/cpp/resource_request_body.h"
 #include "services/network/public/cpp/simple_url_loader.h"
 
 #if BUILDFLAG(ENABLE_IPFS_LOCAL_NODE)
@@ -57,16 +58,6 @@ net::NetworkTrafficAnnotationTag GetIpfsNetworkTrafficAnnotationTag() {
 }
 
 #if BUILDFLAG(ENABLE_IPFS_LOCAL_NODE)
-struct ImportFileInfo {
-  ImportFileInfo(base::FilePath full_path,
-                 base::FileEnumerator::FileInfo information) {
-    path = full_path;
-    info = information;
-  }
-  base::FilePath path;
-  base::FileEnumerator::FileInfo info;
-};
-
 bool GetRelativePathComponent(const base::FilePath& parent,
                               const base::FilePath& child,
                               base::FilePath::StringType* out) {
@@ -111,58 +102,102 @@ std::unique_ptr<storage::BlobDataBuilder> BuildBlobWithText(
   return blob_builder;
 }
 
-std::unique_ptr<storage::BlobDataBuilder> BuildBlobWithFile(
-    base::FilePath upload_file_path,
-    std::string mime_type,
+std::string GetMultipartContentType(const std::string& mime_boundary) {
+  std::string content_type = ipfs::kIPFSImportMultipartContentType;
+  content_type += " boundary=";
+  content_type += mime_boundary;
+  return content_type;
+}
+
+// Multipart bodies are uploaded as a sequence of data elements: the generated
+// part headers are appended as bytes and every file as a file range, so the
+// network service streams file contents from disk instead of us copying them
+// into memory or registering a blob first.
+std::unique_ptr<network::ResourceRequest> CreateMultipartRequest(
+    scoped_refptr<network::ResourceRequestBody> body,
+    const std::string& mime_boundary) {
+  auto request = std::make_unique<network::ResourceRequest>();
+  request->request_body = std::move(body);
+  request->headers.SetHeader(net::HttpRequestHeaders::kContentType,
+                             GetMultipartContentType(mime_boundary));
+  return request;
+}
+
+void AppendFileToBody(network::ResourceRequestBody* body,
+                      const base::FilePath& path,
+                      uint64_t length) {
+  body->AppendFileRange(path, /* offset= */ 0, length,
+                        /* expected_modification_time= */ base::Time());
+}
+
+void AppendBytesToBody(network::ResourceRequestBody* body,
+                       const std::string& data) {
+  body->AppendBytes(std::vector<uint8_t>(data.begin(), data.end()));
+}
+
+std::unique_ptr<network::ResourceRequest> BuildRequestWithFile(
+    const base::FilePath& upload_file_path,
+    const std::string& mime_type,
     std::string filename,
-    std::string mime_boundary,
     size_t file_size) {
-  auto blob_builder =
-      std::make_unique<storage::BlobDataBuilder>(base::GenerateGUID());
+  const std::string mime_boundary = net::GenerateMimeMultipartBoundary();
+  auto body = base::MakeRefCounted<network::ResourceRequestBody>();
   if (filename.empty())
     filename = upload_file_path.BaseName().MaybeAsASCII();
   std::string post_data_header;
   ipfs::AddMultipartHeaderForUploadWithFileName(ipfs::kFileValueName, filename,
                                                 std::string(), mime_boundary,
                                                 mime_type, &post_data_header);
-  blob_builder->AppendData(post_data_header);
-  blob_builder->AppendFile(upload_file_path, /* offset= */ 0, file_size,
-                           /* expected_modification_time= */ base::Time());
+  AppendBytesToBody(body.get(), post_data_header);
+  AppendFileToBody(body.get(), upload_file_path, file_size);
   std::string post_data_footer = "\r\n";
   net::AddMultipartFinalDelimiterForUpload(mime_boundary, &post_data_footer);
-  blob_builder->AppendData(post_data_footer);
+  AppendBytesToBody(body.get(), post_data_footer);
 
-  return blob_builder;
+  return CreateMultipartRequest(std::move(body), mime_boundary);
 }
 
-std::unique_ptr<storage::BlobDataBuilder> BuildBlobWithFolder(
-    base::FilePath upload_path,
-    std::string mime_boundary,
-    std::vector<ImportFileInfo> files) {
-  auto blob_builder =
-      std::make_unique<storage::BlobDataBuilder>(base::GenerateGUID());
-  for (const auto& info : files) {
-    std::string data_header;
+// Enumerates |folder_path| and lays out the upload body as it goes. Only the
+// part headers are held in memory; consecutive headers (directories have no
+// content) are merged into a single bytes element.
+//
+// NOTE: This function does file IO and should not be called on the UI thread.
+std::unique_ptr<network::ResourceRequest> BuildRequestWithFolder(
+    const base::FilePath& folder_path) {
+  const base::FilePath upload_path = folder_path.DirName();
+  const std::string mime_boundary = net::GenerateMimeMultipartBoundary();
+  auto body = base::MakeRefCounted<network::ResourceRequestBody>();
+  std::string pending_data;
+  base::FileEnumerator file_enum(
+      folder_path, true,
+      base::FileEnumerator::FILES | base::FileEnumerator::DIRECTORIES);
+  for (base::FilePath enum_path = file_enum.Next(); !enum_path.empty();
+       enum_path = file_enum.Next()) {
+    // Skip symlinks.
+    if (base::IsLink(enum_path))
+      continue;
+    base::FileEnumerator::FileInfo info = file_enum.GetInfo();
     base::FilePath::StringType relative_path;
-    GetRelativePathComponent(upload_path, info.path, &relative_path);
+    GetRelativePathComponent(upload_path, enum_path, &relative_path);
 
-    std::string mime_type = info.info.IsDirectory() ? ipfs::kDirectoryMimeType
-                                                    : ipfs::kFileMimeType;
-    data_header.append("\r\n");
+    std::string mime_type =
+        info.IsDirectory() ? ipfs::kDirectoryMimeType : ipfs::kFileMimeType;
+    pending_data.append("\r\n");
     ipfs::AddMultipartHeaderForUploadWithFileName(
         ipfs::kFileValueName, base::FilePath(relative_path).MaybeAsASCII(),
-        info.path.MaybeAsASCII(), mime_boundary, mime_type, &data_header);
-    blob_builder->AppendData(data_header);
+        enum_path.MaybeAsASCII(), mime_boundary, mime_type, &pending_data);
     if (mime_type == ipfs::kFileMimeType) {
-      blob_builder->AppendFile(info.path, 0, info.info.GetSize(), base::Time());
+      AppendBytesToBody(body.get(), pending_data);
+      pending_data.clear();
+      AppendFileToBody(body.get(), enum_path, info.GetSize());
     }
   }
 
-  std::string post_data_footer = "\r\n";
-  net::AddMultipartFinalDelimiterForUpload(mime_boundary, &post_data_footer);
-  blob_builder->AppendData(post_data_footer);
+  pending_data.append("\r\n");
+  net::AddMultipartFinalDelimiterForUpload(mime_boundary, &pending_data);
+  AppendBytesToBody(body.get(), pending_data);
 
-  return blob_builder;
+  return CreateMultipartRequest(std::move(body), mime_boundary);
 }
 #endif
 
@@ -248,73 +283,22 @@ int64_t CalculateFileSize(base::FilePath upload_file_path) {
   return file_size;
 }
 
-void CreateRequestForFile(
-    const base::FilePath& upload_file_path,
-    ipfs::BlobContextGetterFactory* blob_context_getter_factory,
-    const std::string& mime_type,
-    const std::string& filename,
-    ResourceRequestGetter request_callback,
-    size_t file_size) {
-  std::string mime_boundary = net::GenerateMimeMultipartBoundary();
-  auto blob_builder_callback =
-      base::BindOnce(&BuildBlobWithFile, upload_file_path, mime_type, filename,
-                     mime_boundary, file_size);
-  std::string content_type = ipfs::kIPFSImportMultipartContentType;
-  content_type += " boundary=";
-  content_type += mime_boundary;
-
-  base::PostTaskAndReplyWithResult(
-      FROM_HERE, {base::MayBlock(), content::BrowserThread::IO},
-      base::BindOnce(&CreateResourceRequest, std::move(blob_builder_callback),
-                     content_type, blob_context_getter_factory),
-      std::move(request_callback));
-}
-
-std::vector<ImportFileInfo> EnumerateDirectoryFiles(base::FilePath dir_path) {
-  std::vector<ImportFileInfo> files;
-  base::FileEnumerator file_enum(
-      dir_path, true,
-      base::FileEnumerator::FILES | base::FileEnumerator::DIRECTORIES);
-  for (base::FilePath enum_path = file_enum.Next(); !enum_path.empty();
-       enum_path = file_enum.Next()) {
-    // Skip symlinks.
-    if (base::IsLink(enum_path))
-      continue;
-    files.push_back(ImportFileInfo(enum_path, file_enum.GetInfo()));
-  }
-
-  return files;
-}
-
-void CreateRequestForFileList(
-    ResourceRequestGetter request_callback,
-    ipfs::BlobContextGetterFactory* blob_context_getter_factory,
-    const base::FilePath& folder_path,
-    std::vector<ImportFileInfo> files) {
-  std::string mime_boundary = net::GenerateMimeMultipartBoundary();
-  auto blob_builder_callback =
-      base::BindOnce(&BuildBlobWithFolder, folder_path.DirName(), mime_boundary,
-                     std::move(files));
-
-  std::string content_type = ipfs::kIPFSImportMultipartContentType;
-  content_type += " boundary=";
-  content_type += mime_boundary;
-
-  base::PostTaskAndReplyWithResult(
-      FROM_HERE, {base::MayBlock(), content::BrowserThread::IO},
-      base::BindOnce(&CreateResourceRequest, std::move(blob_builder_callback),
-                     content_type, blob_context_getter_factory),
-      std::move(request_callback));
+void CreateRequestForFile(const base::FilePath& upload_file_path,
+                          const std::string& mime_type,
+                          const std::string& filename,
+                          ResourceRequestGetter request_callback,
+                          size_t file_size) {
+  std::move(request_callback)
+      .Run(BuildRequestWithFile(upload_file_path, mime_type, filename,
+                                file_size));
 }
 
 void CreateRequestForFolder(const base::FilePath& folder_path,
-                            ipfs::BlobContextGetterFactory* context_factory,
                             ResourceRequestGetter request_callback) {
   base::ThreadPool::PostTaskAndReplyWithResult(
       FROM_HERE, {base::MayBlock()},
-      base::BindOnce(&EnumerateDirectoryFiles, folder_path),
-      base::BindOnce(&CreateRequestForFileList, std::move(request_callback),
-                     context_factory, folder_path));
+      base::BindOnce(&BuildRequestWithFolder, folder_path),
+      std::move(request_callback));
 }
 
 void CreateRequestForText(const std::string& text,
@@ -325,14 +309,10 @@ void CreateRequestForText(const std::string& text,
   auto blob_builder_callback =
       base::BindOnce(&BuildBlobWithText, text, ipfs::kIPFSImportTextMimeType,
                      filename, mime_boundary);
-  std::string content_type = kIPFSImportMultipartContentType;
-  content_type += " boundary=";
-  content_type += mime_boundary;
-
   base::PostTaskAndReplyWithResult(
       FROM_HERE, {base::MayBlock(), content::BrowserThread::IO},
       base::BindOnce(&CreateResourceRequest, std::move(blob_builder_callback),
-                     content_type, context_factory),
+                     GetMultipartContentType(mime_boundary), context_factory),
       std::move(request_callback));
 }
 #endif
@@ -58,15 +58,15 @@ using BlobBuilderCallback =
 using ResourceRequestGetter =
     base::OnceCallback<void(std::unique_ptr<network::ResourceRequest>)>;
 
+// File and folder imports are uploaded straight from disk: the request body
+// is a sequence of generated multipart headers and file range elements.
 void CreateRequestForFile(const base::FilePath& upload_file_path,
-                          BlobContextGetterFactory* blob_context_getter_factory,
                           const std::string& mime_type,
                           const std::string& filename,
                           ResourceRequestGetter request_callback,
                           size_t file_size);
 
 void CreateRequestForFolder(const base::FilePath& folder_path,
-                            BlobContextGetterFactory* context_getter_factory,
                             ResourceRequestGetter request_callback);
 
 void CreateRequestForText(const std::string& text,
@@ -126,8 +126,7 @@ IpfsService::IpfsService(
   }
 #if BUILDFLAG(ENABLE_IPFS_LOCAL_NODE)
   ipns_keys_manager_ = std::make_unique<IpnsKeysManager>(
-      blob_context_getter_factory_.get(), url_loader_factory.get(),
-      server_endpoint_);
+      url_loader_factory.get(), server_endpoint_);
   AddObserver(ipns_keys_manager_.get());
 #endif
 }
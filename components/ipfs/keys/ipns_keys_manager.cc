@@ -12,7 +12,6 @@
 #include "base/rand_util.h"
 #include "base/task/post_task.h"
 #include "base/task/thread_pool.h"
-#include "brave/components/ipfs/blob_context_getter_factory.h"
 #include "brave/components/ipfs/ipfs_constants.h"
 #include "brave/components/ipfs/ipfs_json_parser.h"
 #include "brave/components/ipfs/ipfs_network_utils.h"
@@ -54,14 +53,10 @@ base::TimeDelta CalculateKeysRetryTime() {
 namespace ipfs {
 
 IpnsKeysManager::IpnsKeysManager(
-    BlobContextGetterFactory* context_factory,
     network::mojom::URLLoaderFactory* url_loader_factory,
     const GURL& server_endpoint)
-    : blob_context_getter_factory_(context_factory),
-      url_loader_factory_(url_loader_factory),
-      server_endpoint_(server_endpoint) {
-  DCHECK(blob_context_getter_factory_);
-}
+    : url_loader_factory_(url_loader_factory),
+      server_endpoint_(server_endpoint) {}
 
 IpnsKeysManager::~IpnsKeysManager() {}
 
@@ -72,9 +67,9 @@ void IpnsKeysManager::ImportKey(const base::FilePath& upload_file_path,
       base::BindOnce(&IpnsKeysManager::UploadData, weak_factory_.GetWeakPtr(),
                      std::move(callback), name);
   auto filename = upload_file_path.BaseName().MaybeAsASCII();
-  auto file_request_callback = base::BindOnce(
-      &CreateRequestForFile, upload_file_path, blob_context_getter_factory_,
-      ipfs::kFileMimeType, filename, std::move(upload_callback));
+  auto file_request_callback =
+      base::BindOnce(&CreateRequestForFile, upload_file_path,
+                     ipfs::kFileMimeType, filename, std::move(upload_callback));
   base::ThreadPool::PostTaskAndReplyWithResult(
       FROM_HERE, {base::MayBlock()},
       base::BindOnce(&CalculateFileSize, upload_file_path),
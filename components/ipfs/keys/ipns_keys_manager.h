@@ -15,7 +15,6 @@
 #include "base/containers/queue.h"
 #include "base/memory/raw_ptr.h"
 #include "base/memory/scoped_refptr.h"
-#include "brave/components/ipfs/blob_context_getter_factory.h"
 #include "brave/components/ipfs/ipfs_network_utils.h"
 #include "brave/components/ipfs/ipfs_service_observer.h"
 #include "services/network/public/cpp/resource_request.h"
@@ -35,8 +34,7 @@ namespace ipfs {
 // synchronize and remove p2p keys.
 class IpnsKeysManager : public IpfsServiceObserver {
  public:
-  IpnsKeysManager(BlobContextGetterFactory* blob_context_getter_factory,
-                  network::mojom::URLLoaderFactory* url_loader_factory,
+  IpnsKeysManager(network::mojom::URLLoaderFactory* url_loader_factory,
                   const GURL& server_endpoint);
   ~IpnsKeysManager() override;
 
@@ -97,7 +95,6 @@ class IpnsKeysManager : public IpfsServiceObserver {
                   std::unique_ptr<network::ResourceRequest> request);
 
   int last_load_retry_value_for_test_ = -1;
-  BlobContextGetterFactory* blob_context_getter_factory_ = nullptr;
   raw_ptr<network::mojom::URLLoaderFactory> url_loader_factory_ = nullptr;
   SimpleURLLoaderList url_loaders_;
   std::unordered_map<std::string, std::string> keys_;
@@ -0,0 +1,93 @@
+/* Copyright (c) 2022 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/omnibox/browser/site_substring_index.h"
+
+#include <limits>
+#include <map>
+
+#include "base/check_op.h"
+
+namespace {
+
+// Single characters and character pairs share one key space. Sites never
+// contain NUL, so a pair key always has a non-zero high byte.
+uint16_t CharKey(char c) {
+  return static_cast<uint8_t>(c);
+}
+
+uint16_t PairKey(char first, char second) {
+  return static_cast<uint16_t>(static_cast<uint8_t>(first) << 8) |
+         static_cast<uint8_t>(second);
+}
+
+}  // namespace
+
+SiteSubstringIndex::SiteSubstringIndex(std::vector<std::string> sites)
+    : sites_(std::move(sites)) {
+  CHECK_LE(sites_.size(), std::numeric_limits<uint16_t>::max());
+  std::map<uint16_t, std::vector<uint16_t>> postings;
+  auto post = [&postings](uint16_t key, uint16_t site_index) {
+    std::vector<uint16_t>& list = postings[key];
+    // Sites are visited in order, so a site is already posted under |key| if
+    // and only if it is the last entry.
+    if (list.empty() || list.back() != site_index)
+      list.push_back(site_index);
+  };
+  for (size_t i = 0; i < sites_.size(); ++i) {
+    const std::string& site = sites_[i];
+    const uint16_t site_index = static_cast<uint16_t>(i);
+    for (size_t j = 0; j < site.size(); ++j) {
+      post(CharKey(site[j]), site_index);
+      if (j + 1 < site.size())
+        post(PairKey(site[j], site[j + 1]), site_index);
+    }
+  }
+
+  std::vector<std::pair<uint16_t, std::pair<uint32_t, uint32_t>>> ranges;
+  ranges.reserve(postings.size());
+  for (const auto& posting : postings) {
+    const uint32_t begin = static_cast<uint32_t>(postings_.size());
+    postings_.insert(postings_.end(), posting.second.begin(),
+                     posting.second.end());
+    ranges.emplace_back(
+        posting.first,
+        std::make_pair(begin, static_cast<uint32_t>(postings_.size())));
+  }
+  posting_ranges_ =
+      base::flat_map<uint16_t, std::pair<uint32_t, uint32_t>>(
+          std::move(ranges));
+}
+
+SiteSubstringIndex::~SiteSubstringIndex() = default;
+
+base::span<const uint16_t> SiteSubstringIndex::GetCandidates(
+    base::StringPiece text) const {
+  if (text.empty())
+    return {};
+
+  auto range_for_key = [this](uint16_t key) -> base::span<const uint16_t> {
+    auto it = posting_ranges_.find(key);
+    if (it == posting_ranges_.end())
+      return {};
+    return base::make_span(postings_.data() + it->second.first,
+                           postings_.data() + it->second.second);
+  };
+
+  if (text.size() == 1)
+    return range_for_key(CharKey(text[0]));
+
+  base::span<const uint16_t> shortest;
+  for (size_t i = 0; i + 1 < text.size(); ++i) {
+    base::span<const uint16_t> candidates =
+        range_for_key(PairKey(text[i], text[i + 1]));
+    // A pair no site contains rules out every site.
+    if (candidates.empty())
+      return {};
+    if (i == 0 || candidates.size() < shortest.size())
+      shortest = candidates;
+  }
+  return shortest;
+}
@@ -0,0 +1,61 @@
+/* Copyright (c) 2022 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#ifndef BRAVE_COMPONENTS_OMNIBOX_BROWSER_SITE_SUBSTRING_INDEX_H_
+#define BRAVE_COMPONENTS_OMNIBOX_BROWSER_SITE_SUBSTRING_INDEX_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "base/containers/flat_map.h"
+#include "base/containers/span.h"
+#include "base/strings/string_piece.h"
+
+// Answers "which sites contain this text" over a fixed list of sites, in list
+// order. Every site is posted under each distinct character and each distinct
+// pair of adjacent characters it contains. A lookup walks the shortest posting
+// list among the pairs of the text and confirms each candidate with a
+// substring search, so it neither allocates nor looks at sites that cannot
+// match.
+class SiteSubstringIndex {
+ public:
+  explicit SiteSubstringIndex(std::vector<std::string> sites);
+  SiteSubstringIndex(const SiteSubstringIndex&) = delete;
+  SiteSubstringIndex& operator=(const SiteSubstringIndex&) = delete;
+  ~SiteSubstringIndex();
+
+  // Runs |callback| with the index of every site containing |text| and the
+  // position of the first occurrence, in list order, until |callback| returns
+  // false.
+  template <typename Callback>
+  void FindSites(base::StringPiece text, Callback callback) const {
+    for (uint16_t site_index : GetCandidates(text)) {
+      const size_t found_pos =
+          sites_[site_index].find(text.data(), 0, text.size());
+      if (found_pos == std::string::npos)
+        continue;
+      if (!callback(static_cast<size_t>(site_index), found_pos))
+        return;
+    }
+  }
+
+  const std::string& site(size_t index) const { return sites_[index]; }
+  size_t size() const { return sites_.size(); }
+
+ private:
+  base::span<const uint16_t> GetCandidates(base::StringPiece text) const;
+
+  std::vector<std::string> sites_;
+  // Site indices of all posting lists, back to back.
+  std::vector<uint16_t> postings_;
+  // Character or character pair key to its [begin, end) range in |postings_|.
+  base::flat_map<uint16_t, std::pair<uint32_t, uint32_t>> posting_ranges_;
+};
+
+#endif  // BRAVE_COMPONENTS_OMNIBOX_BROWSER_SITE_SUBSTRING_INDEX_H_
@@ -0,0 +1,130 @@
+/* Copyright (c) 2022 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/omnibox/browser/site_substring_index.h"
+
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "base/logging.h"
+#include "base/timer/elapsed_timer.h"
+#include "brave/components/omnibox/browser/topsites_provider.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace {
+
+using SiteMatch = std::pair<size_t, size_t>;
+
+// Same cap as the omnibox applies to a single provider.
+constexpr size_t kMaxMatches = 3;
+
+std::vector<SiteMatch> FindWithIndex(const SiteSubstringIndex& index,
+                                     const std::string& text,
+                                     size_t max_matches) {
+  std::vector<SiteMatch> matches;
+  index.FindSites(text, [&](size_t site_index, size_t found_pos) {
+    matches.emplace_back(site_index, found_pos);
+    return matches.size() < max_matches;
+  });
+  return matches;
+}
+
+std::vector<SiteMatch> FindWithLinearScan(const std::vector<std::string>& sites,
+                                          const std::string& text,
+                                          size_t max_matches) {
+  std::vector<SiteMatch> matches;
+  for (size_t i = 0; i < sites.size() && matches.size() < max_matches; ++i) {
+    size_t found_pos = sites[i].find(text);
+    if (found_pos != std::string::npos)
+      matches.emplace_back(i, found_pos);
+  }
+  return matches;
+}
+
+// Every prefix of every site, i.e. what typing each site key by key queries.
+std::vector<std::string> GetKeystrokeQueries(
+    const std::vector<std::string>& sites) {
+  std::vector<std::string> queries;
+  for (const auto& site : sites) {
+    for (size_t length = 1; length <= site.size(); ++length)
+      queries.push_back(site.substr(0, length));
+  }
+  return queries;
+}
+
+}  // namespace
+
+TEST(SiteSubstringIndexTest, FindsSubstringsInListOrder) {
+  SiteSubstringIndex index({"brave.com", "example.com", "bravery.org", "a"});
+
+  EXPECT_EQ(FindWithIndex(index, "brave", 10),
+            (std::vector<SiteMatch>{{0, 0}, {2, 0}}));
+  EXPECT_EQ(FindWithIndex(index, ".com", 10),
+            (std::vector<SiteMatch>{{0, 5}, {1, 7}}));
+  EXPECT_EQ(FindWithIndex(index, "a", 10),
+            (std::vector<SiteMatch>{{0, 2}, {1, 2}, {2, 2}, {3, 0}}));
+  // Stops as soon as the callback says so.
+  EXPECT_EQ(FindWithIndex(index, "a", 2),
+            (std::vector<SiteMatch>{{0, 2}, {1, 2}}));
+  // All pairs occur somewhere, but never together.
+  EXPECT_TRUE(FindWithIndex(index, "bram", 10).empty());
+  EXPECT_TRUE(FindWithIndex(index, "xyz", 10).empty());
+  EXPECT_TRUE(FindWithIndex(index, "", 10).empty());
+}
+
+TEST(SiteSubstringIndexTest, MatchesLinearScanOverTopSites) {
+  const std::vector<std::string>& sites =
+      TopSitesProvider::GetTopSitesForTesting();
+  SiteSubstringIndex index(sites);
+  ASSERT_EQ(index.size(), sites.size());
+
+  std::vector<std::string> queries = GetKeystrokeQueries(sites);
+  for (const auto& query : {"o", "oo", ".co", "xn--", "zzz", "mail.", "-"})
+    queries.push_back(query);
+  for (const auto& query : queries) {
+    EXPECT_EQ(FindWithIndex(index, query, kMaxMatches),
+              FindWithLinearScan(sites, query, kMaxMatches))
+        << query;
+    EXPECT_EQ(FindWithIndex(index, query, sites.size()),
+              FindWithLinearScan(sites, query, sites.size()))
+        << query;
+  }
+}
+
+// Types every built-in top site key by key and reports the average time per
+// keystroke for the index and for the linear scan it replaces.
+TEST(SiteSubstringIndexTest, KeystrokeLatencyBenchmark) {
+  const std::vector<std::string>& sites =
+      TopSitesProvider::GetTopSitesForTesting();
+  SiteSubstringIndex index(sites);
+  const std::vector<std::string> queries = GetKeystrokeQueries(sites);
+  ASSERT_FALSE(queries.empty());
+
+  size_t index_matches = 0;
+  base::ElapsedTimer index_timer;
+  for (const auto& query : queries) {
+    size_t query_matches = 0;
+    index.FindSites(query, [&](size_t, size_t) {
+      ++index_matches;
+      return ++query_matches < kMaxMatches;
+    });
+  }
+  const base::TimeDelta index_elapsed = index_timer.Elapsed();
+
+  size_t scan_matches = 0;
+  base::ElapsedTimer scan_timer;
+  for (const auto& query : queries)
+    scan_matches += FindWithLinearScan(sites, query, kMaxMatches).size();
+  const base::TimeDelta scan_elapsed = scan_timer.Elapsed();
+
+  EXPECT_GT(index_matches, 0u);
+  EXPECT_GT(scan_matches, 0u);
+  LOG(INFO) << "Top sites keystroke latency over " << queries.size()
+            << " keystrokes: index "
+            << index_elapsed.InNanoseconds() / queries.size()
+            << "ns, linear scan "
+            << scan_elapsed.InNanoseconds() / queries.size() << "ns";
+}
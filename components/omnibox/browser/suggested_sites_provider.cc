@@ -8,9 +8,11 @@
 #include <algorithm>
 #include <utility>
 
+#include "base/no_destructor.h"
 #include "base/strings/string_util.h"
 #include "base/strings/utf_string_conversions.h"
 #include "brave/common/pref_names.h"
+#include "brave/components/omnibox/browser/site_substring_index.h"
 #include "components/omnibox/browser/autocomplete_input.h"
 #include "components/omnibox/browser/autocomplete_provider_client.h"
 #include "components/prefs/pref_service.h"
@@ -19,6 +21,23 @@
 // Search Secondary Provider (suggestion) |  100++
 const int SuggestedSitesProvider::kRelevance = 100;
 
+namespace {
+
+// |suggested_sites| is the static list, so the index is built once and shared
+// by all providers.
+const SiteSubstringIndex& GetSuggestedSitesIndex(
+    const std::vector<SuggestedSitesMatch>& suggested_sites) {
+  static const base::NoDestructor<SiteSubstringIndex> index([&] {
+    std::vector<std::string> match_strings;
+    for (const auto& match : suggested_sites)
+      match_strings.push_back(match.match_string_);
+    return match_strings;
+  }());
+  return *index;
+}
+
+}  // namespace
+
 
 SuggestedSitesProvider::SuggestedSitesProvider(
     AutocompleteProviderClient* client)
@@ -41,28 +60,25 @@ void SuggestedSitesProvider::Start(const AutocompleteInput& input,
 
   const std::string input_text =
       base::ToLowerASCII(base::UTF16ToUTF8(input.text()));
-  auto check_add_match =
-      [&](const SuggestedSitesMatch& match) {
-    // Don't bother matching until 4 chars, or less if it's an exact match
-    if (input_text.length() < 4 &&
-        match.match_string_.length() != input_text.length()) {
-      return;
-    }
-    size_t foundPos = match.match_string_.find(input_text);
-    // We'd normally check for npos here but we want only people that
-    // really want these suggestions. Example don't suggest bitcoin and
-    // litecoin for just a coin search.
-    if (foundPos == 0) {
-      ACMatchClassifications styles =
-          StylesForSingleMatch(input_text,
-              base::UTF16ToASCII(match.display_));
-      AddMatch(match, styles);
-    }
-  };
-
   const auto& suggested_sites = GetSuggestedSites();
-  std::for_each(suggested_sites.begin(), suggested_sites.end(),
-      check_add_match);
+  GetSuggestedSitesIndex(suggested_sites).FindSites(
+      input_text, [&](size_t site_index, size_t foundPos) {
+        const SuggestedSitesMatch& match = suggested_sites[site_index];
+        // Don't bother matching until 4 chars, or less if it's an exact match
+        if (input_text.length() < 4 &&
+            match.match_string_.length() != input_text.length()) {
+          return true;
+        }
+        // We'd normally accept any position here but we want only people
+        // that really want these suggestions. Example don't suggest bitcoin
+        // and litecoin for just a coin search.
+        if (foundPos == 0) {
+          ACMatchClassifications styles = StylesForSingleMatch(
+              input_text, base::UTF16ToASCII(match.display_));
+          AddMatch(match, styles);
+        }
+        return true;
+      });
 }
 
 SuggestedSitesProvider::~SuggestedSitesProvider() {}
@@ -32,7 +32,7 @@ class SuggestedSitesProvider : public AutocompleteProvider {
 
   static const int kRelevance;
 
-  const std::vector<SuggestedSitesMatch>& GetSuggestedSites();
+  static const std::vector<SuggestedSitesMatch>& GetSuggestedSites();
   void AddMatch(const SuggestedSitesMatch& match,
                 const ACMatchClassifications& styles);
 
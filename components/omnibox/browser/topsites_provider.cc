@@ -10,9 +10,11 @@
 #include <algorithm>
 #include <string>
 
+#include "base/no_destructor.h"
 #include "base/strings/string_util.h"
 #include "base/strings/utf_string_conversions.h"
 #include "brave/common/pref_names.h"
+#include "brave/components/omnibox/browser/site_substring_index.h"
 #include "components/omnibox/browser/autocomplete_input.h"
 #include "components/omnibox/browser/history_provider.h"
 #include "components/prefs/pref_service.h"
@@ -42,17 +44,14 @@ void TopSitesProvider::Start(const AutocompleteInput& input,
   const std::string input_text =
       base::ToLowerASCII(base::UTF16ToUTF8(input.text()));
 
-  for (std::vector<std::string>::const_iterator i = top_sites_.begin();
-       (i != top_sites_.end()) && (matches_.size() < provider_max_matches());
-       ++i) {
-    const std::string &current_site = *i;
-    size_t foundPos = current_site.find(input_text);
-    if (std::string::npos != foundPos) {
-      ACMatchClassifications styles =
-          StylesForSingleMatch(input_text, current_site, foundPos);
-      AddMatch(base::ASCIIToUTF16(current_site), styles);
-    }
-  }
+  GetTopSitesIndex().FindSites(
+      input_text, [&](size_t site_index, size_t foundPos) {
+        const std::string& current_site = top_sites_[site_index];
+        ACMatchClassifications styles =
+            StylesForSingleMatch(input_text, current_site, foundPos);
+        AddMatch(base::ASCIIToUTF16(current_site), styles);
+        return matches_.size() < provider_max_matches();
+      });
 
   for (size_t i = 0; i < matches_.size(); ++i) {
     matches_[i].relevance = kRelevance + matches_.size() - (i + 1);
@@ -70,6 +69,17 @@ void TopSitesProvider::Start(const AutocompleteInput& input,
 
 TopSitesProvider::~TopSitesProvider() {}
 
+// static
+const std::vector<std::string>& TopSitesProvider::GetTopSitesForTesting() {
+  return top_sites_;
+}
+
+// static
+const SiteSubstringIndex& TopSitesProvider::GetTopSitesIndex() {
+  static const base::NoDestructor<SiteSubstringIndex> index(top_sites_);
+  return *index;
+}
+
 // static
 ACMatchClassifications TopSitesProvider::StylesForSingleMatch(
     const std::string &input_text,
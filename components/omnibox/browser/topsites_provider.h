@@ -15,6 +15,7 @@
 #include "components/omnibox/browser/autocomplete_provider.h"
 
 class AutocompleteProviderClient;
+class SiteSubstringIndex;
 
 // This is the provider for top Alexa 500 sites URLs
 class TopSitesProvider : public AutocompleteProvider {
@@ -26,6 +27,8 @@ class TopSitesProvider : public AutocompleteProvider {
   // AutocompleteProvider:
   void Start(const AutocompleteInput& input, bool minimal_changes) override;
 
+  static const std::vector<std::string>& GetTopSitesForTesting();
+
  private:
   ~TopSitesProvider() override;
 
@@ -33,6 +36,8 @@ class TopSitesProvider : public AutocompleteProvider {
 
   static std::vector<std::string> top_sites_;
 
+  static const SiteSubstringIndex& GetTopSitesIndex();
+
   void AddMatch(const std::u16string& match_string,
                 const ACMatchClassifications& styles);
 
@@ -5,6 +5,7 @@
 
 #include "brave/components/p3a/brave_p3a_log_store.h"
 
+#include "base/bind.h"
 #include "base/logging.h"
 #include "base/metrics/histogram_macros.h"
 #include "base/rand_util.h"
@@ -22,6 +23,9 @@ constexpr char kLogValueKey[] = "value";
 constexpr char kLogSentKey[] = "sent";
 constexpr char kLogTimestampKey[] = "timestamp";
 
+// Value updates are coalesced for this long before being written.
+constexpr base::TimeDelta kPersistDelay = base::Seconds(5);
+
 void RecordP3A(uint64_t answers_count) {
   int answer = 0;
   if (1 <= answers_count && answers_count < 5) {
@@ -51,18 +55,18 @@ void BraveP3ALogStore::RegisterPrefs(PrefRegistrySimple* registry) {
 
 void BraveP3ALogStore::UpdateValue(const std::string& histogram_name,
                                    uint64_t value) {
-  LogEntry& entry = log_[histogram_name];
+  auto result = log_.try_emplace(histogram_name);
+  LogEntry& entry = result.first->second;
+  if (!result.second && entry.value == value) {
+    return;
+  }
   entry.value = value;
   if (!entry.sent) {
     DCHECK(entry.sent_timestamp.is_null());
     unsent_entries_.insert(histogram_name);
   }
 
-  // Update the persistent value.
-  DictionaryPrefUpdate update(local_state_, kPrefName);
-  update->SetPath({histogram_name, kLogValueKey},
-                  base::Value(base::NumberToString(value)));
-  update->SetPath({histogram_name, kLogSentKey}, base::Value(entry.sent));
+  SchedulePersist(histogram_name);
 }
 
 void BraveP3ALogStore::RemoveValueIfExists(const std::string& histogram_name) {
@@ -70,9 +74,9 @@ void BraveP3ALogStore::RemoveValueIfExists(const std::string& histogram_name) {
   log_.erase(histogram_name);
   unsent_entries_.erase(histogram_name);
 
-  // Update the persistent value.
-  DictionaryPrefUpdate update(local_state_, kPrefName);
-  update->RemovePath(histogram_name);
+  // Persisted values may exist even if the entry was not loaded, so always
+  // let the write drop it.
+  SchedulePersist(histogram_name);
 
   if (has_staged_log() && staged_entry_key_ == histogram_name) {
     staged_entry_key_.clear();
@@ -82,20 +86,16 @@ void BraveP3ALogStore::RemoveValueIfExists(const std::string& histogram_name) {
 
 void BraveP3ALogStore::ResetUploadStamps() {
   // Clear log entries flags.
-  DictionaryPrefUpdate update(local_state_, kPrefName);
   for (auto& pair : log_) {
     if (pair.second.sent) {
       DCHECK(!pair.second.sent_timestamp.is_null());
       DCHECK(!unsent_entries_.contains(pair.first));
 
       pair.second.ResetSentState();
-
-      // Update persistent values.
-      update->SetPath({pair.first, kLogSentKey}, base::Value(pair.second.sent));
-      update->SetPath({pair.first, kLogTimestampKey},
-                      base::Value(pair.second.sent_timestamp.ToDoubleT()));
+      pending_persist_entries_.insert(pair.first);
     }
   }
+  PersistPendingUpdates();
 
   RecordP3A(log_.size() - unsent_entries_.size());
 
@@ -106,6 +106,39 @@ void BraveP3ALogStore::ResetUploadStamps() {
   }
 }
 
+void BraveP3ALogStore::PersistPendingUpdates() {
+  persist_timer_.Stop();
+  if (pending_persist_entries_.empty()) {
+    return;
+  }
+
+  DictionaryPrefUpdate update(local_state_, kPrefName);
+  for (const std::string& name : pending_persist_entries_) {
+    auto iter = log_.find(name);
+    if (iter == log_.end()) {
+      update->RemoveKey(name);
+      continue;
+    }
+    const LogEntry& entry = iter->second;
+    update->SetPath({name, kLogValueKey},
+                    base::Value(base::NumberToString(entry.value)));
+    update->SetPath({name, kLogSentKey}, base::Value(entry.sent));
+    update->SetPath({name, kLogTimestampKey},
+                    base::Value(entry.sent_timestamp.ToDoubleT()));
+  }
+  pending_persist_entries_.clear();
+}
+
+void BraveP3ALogStore::SchedulePersist(const std::string& histogram_name) {
+  pending_persist_entries_.insert(histogram_name);
+  if (!persist_timer_.IsRunning()) {
+    persist_timer_.Start(
+        FROM_HERE, kPersistDelay,
+        base::BindOnce(&BraveP3ALogStore::PersistPendingUpdates,
+                       base::Unretained(this)));
+  }
+}
+
 bool BraveP3ALogStore::has_unsent_logs() const {
   return !unsent_entries_.empty();
 }
@@ -180,12 +213,9 @@ void BraveP3ALogStore::DiscardStagedLog() {
   DCHECK(log_iter != log_.end());
   log_iter->second.MarkAsSent();
 
-  // Update the persistent value.
-  DictionaryPrefUpdate update(local_state_, kPrefName);
-  update->SetPath({log_iter->first, kLogSentKey},
-                  base::Value(log_iter->second.sent));
-  update->SetPath({log_iter->first, kLogTimestampKey},
-                  base::Value(log_iter->second.sent_timestamp.ToDoubleT()));
+  // Update the persistent value, together with anything still pending.
+  pending_persist_entries_.insert(log_iter->first);
+  PersistPendingUpdates();
 
   // Erase the entry from the unsent queue.
   auto unsent_entries_iter = unsent_entries_.find(staged_entry_key_);
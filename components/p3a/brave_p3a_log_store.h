@@ -12,6 +12,7 @@
 #include "base/containers/flat_set.h"
 #include "base/strings/string_piece.h"
 #include "base/time/time.h"
+#include "base/timer/timer.h"
 #include "components/metrics/log_store.h"
 #include "third_party/abseil-cpp/absl/types/optional.h"
 
@@ -20,7 +21,11 @@ class PrefRegistrySimple;
 
 namespace brave {
 
-// Stores all given values in memory and persists in prefs on the fly.
+// Stores all given values in memory and persists them in prefs. Value
+// updates are written with a short delay, so a burst of samples results in a
+// single local state update; sent state changes are written right away. The
+// owner writes delayed updates on shutdown with |PersistPendingUpdates()|,
+// the destructor doesn't touch local state.
 // All logs (not only unsent are persistent), and all logs could be loaded
 // using |LoadPersistedUnsentLogs()|. We should fix this at some point since
 // for now persisted entries never expire.
@@ -58,6 +63,8 @@ class BraveP3ALogStore : public metrics::LogStore {
   void RemoveValueIfExists(const std::string& histogram_name);
   // Marks all saved values as unsent.
   void ResetUploadStamps();
+  // Writes all changes that are still waiting for the delayed write.
+  void PersistPendingUpdates();
 
   // metrics::LogStore:
   bool has_unsent_logs() const override;
@@ -74,7 +81,7 @@ class BraveP3ALogStore : public metrics::LogStore {
   void MarkStagedLogAsSent() override;
 
   // |TrimAndPersistUnsentLogs| should not be used, since we persist everything
-  // on the fly.
+  // ourselves.
   void TrimAndPersistUnsentLogs() override;
   // Returns early if founds malformed persisted values.
   void LoadPersistedUnsentLogs() override;
@@ -97,6 +104,10 @@ class BraveP3ALogStore : public metrics::LogStore {
     base::Time sent_timestamp;  // At the moment only for debugging purposes.
   };
 
+  // Remembers that |histogram_name| differs from its persisted state and
+  // schedules a write.
+  void SchedulePersist(const std::string& histogram_name);
+
   Delegate* const delegate_ = nullptr;  // Weak.
   PrefService* const local_state_ = nullptr;
 
@@ -104,6 +115,10 @@ class BraveP3ALogStore : public metrics::LogStore {
   base::flat_map<std::string, LogEntry> log_;
   base::flat_set<std::string> unsent_entries_;
 
+  // Entries that changed since the last write to local state.
+  base::flat_set<std::string> pending_persist_entries_;
+  base::OneShotTimer persist_timer_;
+
   std::string staged_entry_key_;
   LogForJsonMigration staged_log_;
 
@@ -0,0 +1,164 @@
+/* Copyright (c) 2022 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/p3a/brave_p3a_log_store.h"
+
+#include <string>
+
+#include "base/bind.h"
+#include "base/strings/string_number_conversions.h"
+#include "base/test/task_environment.h"
+#include "components/prefs/pref_change_registrar.h"
+#include "components/prefs/testing_pref_service.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+// npm run test -- brave_unit_tests --filter=BraveP3ALogStoreTest.*
+
+namespace brave {
+
+namespace {
+
+constexpr char kPrefName[] = "p3a.logs";
+constexpr size_t kHistogramCount = 10;
+constexpr size_t kSamplesPerHistogram = 500;
+
+class TestDelegate : public BraveP3ALogStore::Delegate {
+ public:
+  BraveP3ALogStore::LogForJsonMigration Serialize(
+      base::StringPiece histogram_name,
+      uint64_t value) override {
+    BraveP3ALogStore::LogForJsonMigration log;
+    log.legacy_log = std::string(histogram_name);
+    log.json_log = std::string(histogram_name);
+    return log;
+  }
+
+  bool IsActualMetric(base::StringPiece histogram_name) const override {
+    return true;
+  }
+};
+
+std::string HistogramName(size_t index) {
+  return "Brave.Test.Histogram" + base::NumberToString(index);
+}
+
+}  // namespace
+
+class BraveP3ALogStoreTest : public testing::Test {
+ public:
+  void SetUp() override {
+    BraveP3ALogStore::RegisterPrefs(local_state_.registry());
+    registrar_.Init(&local_state_);
+    registrar_.Add(kPrefName,
+                   base::BindRepeating(&BraveP3ALogStoreTest::OnPrefChanged,
+                                       base::Unretained(this)));
+  }
+
+ protected:
+  void OnPrefChanged() { pref_writes_++; }
+
+  base::test::TaskEnvironment task_environment_{
+      base::test::TaskEnvironment::TimeSource::MOCK_TIME};
+  TestingPrefServiceSimple local_state_;
+  PrefChangeRegistrar registrar_;
+  TestDelegate delegate_;
+  size_t pref_writes_ = 0;
+};
+
+TEST_F(BraveP3ALogStoreTest, CoalescesValueUpdates) {
+  BraveP3ALogStore log_store(&delegate_, &local_state_);
+  log_store.LoadPersistedUnsentLogs();
+
+  for (size_t sample = 0; sample < kSamplesPerHistogram; sample++) {
+    for (size_t i = 0; i < kHistogramCount; i++) {
+      log_store.UpdateValue(HistogramName(i), sample);
+    }
+  }
+  EXPECT_EQ(pref_writes_, 0u);
+  EXPECT_TRUE(log_store.has_unsent_logs());
+
+  task_environment_.FastForwardBy(base::Minutes(1));
+  EXPECT_EQ(pref_writes_, 1u);
+
+  // Persisted state has the latest values.
+  BraveP3ALogStore restored_store(&delegate_, &local_state_);
+  restored_store.LoadPersistedUnsentLogs();
+  for (size_t i = 0; i < kHistogramCount; i++) {
+    ASSERT_TRUE(restored_store.has_unsent_logs());
+    restored_store.StageNextLog();
+    restored_store.DiscardStagedLog();
+  }
+  EXPECT_FALSE(restored_store.has_unsent_logs());
+  const base::Value* value = local_state_.GetDictionary(kPrefName)->FindPath(
+      {HistogramName(0), "value"});
+  ASSERT_TRUE(value);
+  EXPECT_EQ(value->GetString(),
+            base::NumberToString(kSamplesPerHistogram - 1));
+}
+
+TEST_F(BraveP3ALogStoreTest, SentStateIsWrittenImmediately) {
+  BraveP3ALogStore log_store(&delegate_, &local_state_);
+  log_store.LoadPersistedUnsentLogs();
+  log_store.UpdateValue(HistogramName(0), 1);
+  log_store.UpdateValue(HistogramName(1), 2);
+
+  // Discarding a staged log flushes pending values along with the sent flag.
+  log_store.StageNextLog();
+  log_store.DiscardStagedLog();
+  EXPECT_EQ(pref_writes_, 1u);
+
+  // Nothing is left for the timer.
+  task_environment_.FastForwardBy(base::Minutes(1));
+  EXPECT_EQ(pref_writes_, 1u);
+
+  // Unchanged values do not schedule writes.
+  log_store.UpdateValue(HistogramName(0), 1);
+  log_store.UpdateValue(HistogramName(1), 2);
+  task_environment_.FastForwardBy(base::Minutes(1));
+  EXPECT_EQ(pref_writes_, 1u);
+
+  log_store.ResetUploadStamps();
+  EXPECT_EQ(pref_writes_, 2u);
+
+  log_store.RemoveValueIfExists(HistogramName(0));
+  task_environment_.FastForwardBy(base::Minutes(1));
+  EXPECT_EQ(pref_writes_, 3u);
+  EXPECT_FALSE(
+      local_state_.GetDictionary(kPrefName)->FindKey(HistogramName(0)));
+}
+
+TEST_F(BraveP3ALogStoreTest, PendingUpdatesAreWrittenOnPersist) {
+  BraveP3ALogStore log_store(&delegate_, &local_state_);
+  log_store.LoadPersistedUnsentLogs();
+  log_store.UpdateValue(HistogramName(0), 3);
+  EXPECT_EQ(pref_writes_, 0u);
+
+  log_store.PersistPendingUpdates();
+  EXPECT_EQ(pref_writes_, 1u);
+
+  const base::Value* value = local_state_.GetDictionary(kPrefName)->FindPath(
+      {HistogramName(0), "value"});
+  ASSERT_TRUE(value);
+  EXPECT_EQ(value->GetString(), "3");
+
+  // Nothing is left for the timer to write.
+  task_environment_.FastForwardBy(base::Minutes(1));
+  EXPECT_EQ(pref_writes_, 1u);
+}
+
+TEST_F(BraveP3ALogStoreTest, DestructionDoesNotWritePrefs) {
+  {
+    BraveP3ALogStore log_store(&delegate_, &local_state_);
+    log_store.LoadPersistedUnsentLogs();
+    log_store.UpdateValue(HistogramName(0), 3);
+  }
+  EXPECT_EQ(pref_writes_, 0u);
+
+  // The timer went away with the store.
+  task_environment_.FastForwardBy(base::Minutes(1));
+  EXPECT_EQ(pref_writes_, 0u);
+}
+
+}  // namespace brave
@@ -309,6 +309,11 @@ void BraveP3AService::Init(
   }
 }
 
+void BraveP3AService::PersistPendingUpdates() {
+  if (log_store_)
+    log_store_->PersistPendingUpdates();
+}
+
 BraveP3ALogStore::LogForJsonMigration BraveP3AService::Serialize(
     base::StringPiece histogram_name,
     uint64_t value) {
@@ -451,12 +456,8 @@ void BraveP3AService::OnHistogramChanged(const char* histogram_name,
   // Shortcut for the special values, see |kSuspendedMetricValue|
   // description for details.
   if (IsSuspendedMetric(histogram_name, sample)) {
-    base::PostTask(FROM_HERE, {content::BrowserThread::UI},
-                   base::BindOnce(&BraveP3AService::OnHistogramChangedOnUI,
-                                  this,
-                                  histogram_name,
-                                  kSuspendedMetricValue,
-                                  kSuspendedMetricBucket));
+    QueueHistogramChange(histogram_name, kSuspendedMetricValue,
+                         kSuspendedMetricBucket);
     return;
   }
 
@@ -485,12 +486,39 @@ void BraveP3AService::OnHistogramChanged(const char* histogram_name,
     bucket = DirectEncodingProtocol::Perturb(bucket_count, bucket);
   }
 
-  base::PostTask(FROM_HERE, {content::BrowserThread::UI},
-                 base::BindOnce(&BraveP3AService::OnHistogramChangedOnUI, this,
-                                histogram_name, sample, bucket));
+  QueueHistogramChange(histogram_name, sample, bucket);
+}
+
+void BraveP3AService::QueueHistogramChange(base::StringPiece histogram_name,
+                                           base::HistogramBase::Sample sample,
+                                           size_t bucket) {
+  {
+    base::AutoLock lock(queued_histogram_changes_lock_);
+    const bool has_pending_task = !queued_histogram_changes_.empty();
+    queued_histogram_changes_[histogram_name] = {sample, bucket};
+    if (has_pending_task)
+      return;
+  }
+  base::PostTask(
+      FROM_HERE, {content::BrowserThread::UI},
+      base::BindOnce(&BraveP3AService::OnQueuedHistogramChangesOnUI, this));
+}
+
+void BraveP3AService::OnQueuedHistogramChangesOnUI() {
+  base::flat_map<base::StringPiece,
+                 std::pair<base::HistogramBase::Sample, size_t>>
+      changes;
+  {
+    base::AutoLock lock(queued_histogram_changes_lock_);
+    changes.swap(queued_histogram_changes_);
+  }
+  for (const auto& change : changes) {
+    OnHistogramChangedOnUI(change.first, change.second.first,
+                           change.second.second);
+  }
 }
 
-void BraveP3AService::OnHistogramChangedOnUI(const char* histogram_name,
+void BraveP3AService::OnHistogramChangedOnUI(base::StringPiece histogram_name,
                                              base::HistogramBase::Sample sample,
                                              size_t bucket) {
   VLOG(2) << "BraveP3AService::OnHistogramChanged: histogram_name = "
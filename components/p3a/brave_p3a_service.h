@@ -8,12 +8,15 @@
 
 #include <memory>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "base/containers/flat_map.h"
 #include "base/memory/ref_counted.h"
 #include "base/metrics/histogram_base.h"
 #include "base/metrics/statistics_recorder.h"
+#include "base/synchronization/lock.h"
+#include "base/thread_annotations.h"
 #include "base/timer/wall_clock_timer.h"
 #include "brave/components/p3a/brave_p3a_log_store.h"
 #include "brave/components/p3a/p3a_message.h"
@@ -55,6 +58,10 @@ class BraveP3AService : public base::RefCountedThreadSafe<BraveP3AService>,
   void Init(
       scoped_refptr<network::SharedURLLoaderFactory> url_loader_factory);
 
+  // Writes the log store changes that are still waiting for the delayed
+  // write. Called on shutdown, while local state can still be saved.
+  void PersistPendingUpdates();
+
   // BraveP3ALogStore::Delegate
   BraveP3ALogStore::LogForJsonMigration Serialize(
       base::StringPiece histogram_name,
@@ -65,6 +72,7 @@ class BraveP3AService : public base::RefCountedThreadSafe<BraveP3AService>,
 
  private:
   friend class base::RefCountedThreadSafe<BraveP3AService>;
+  friend class BraveP3AServiceTest;
   ~BraveP3AService() override;
 
   void MaybeOverrideSettingsFromCommandLine();
@@ -82,7 +90,15 @@ class BraveP3AService : public base::RefCountedThreadSafe<BraveP3AService>,
                           uint64_t name_hash,
                           base::HistogramBase::Sample sample);
 
-  void OnHistogramChangedOnUI(const char* histogram_name,
+  // Keeps the latest value of the histogram until the UI thread picks it up.
+  // Only the first change in a batch posts a task.
+  void QueueHistogramChange(base::StringPiece histogram_name,
+                            base::HistogramBase::Sample sample,
+                            size_t bucket);
+
+  void OnQueuedHistogramChangesOnUI();
+
+  void OnHistogramChangedOnUI(base::StringPiece histogram_name,
                               base::HistogramBase::Sample sample,
                               size_t bucket);
 
@@ -123,6 +139,12 @@ class BraveP3AService : public base::RefCountedThreadSafe<BraveP3AService>,
   // the service and its initialization.
   base::flat_map<base::StringPiece, size_t> histogram_values_;
 
+  // Histogram changes recorded on any thread, waiting to be handled on UI.
+  base::Lock queued_histogram_changes_lock_;
+  base::flat_map<base::StringPiece,
+                 std::pair<base::HistogramBase::Sample, size_t>>
+      queued_histogram_changes_ GUARDED_BY(queued_histogram_changes_lock_);
+
   // Once fired we restart the overall uploading process.
   base::WallClockTimer rotation_timer_;
 
@@ -0,0 +1,95 @@
+/* Copyright (c) 2022 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/p3a/brave_p3a_service.h"
+
+#include <iterator>
+
+#include "base/bind.h"
+#include "base/containers/flat_map.h"
+#include "base/memory/scoped_refptr.h"
+#include "base/strings/string_piece.h"
+#include "base/task/thread_pool.h"
+#include "base/task/thread_pool/thread_pool_instance.h"
+#include "components/prefs/testing_pref_service.h"
+#include "content/public/test/browser_task_environment.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+// npm run test -- brave_unit_tests --filter=BraveP3AServiceTest.*
+
+namespace brave {
+
+namespace {
+
+// Histogram names are kept as string pieces, so they need static storage
+// like the names of real histograms.
+constexpr const char* kHistogramNames[] = {
+    "Brave.Test.Histogram0", "Brave.Test.Histogram1", "Brave.Test.Histogram2",
+    "Brave.Test.Histogram3"};
+constexpr size_t kChangesPerHistogram = 100;
+
+}  // namespace
+
+class BraveP3AServiceTest : public testing::Test {
+ public:
+  void SetUp() override {
+    BraveP3AService::RegisterPrefs(local_state_.registry(), true);
+    service_ = base::MakeRefCounted<BraveP3AService>(&local_state_, "release",
+                                                     "2022-01-10");
+  }
+
+  void QueueHistogramChange(base::StringPiece histogram_name, size_t bucket) {
+    service_->QueueHistogramChange(
+        histogram_name, static_cast<base::HistogramBase::Sample>(bucket),
+        bucket);
+  }
+
+  const base::flat_map<base::StringPiece, size_t>& histogram_values() const {
+    return service_->histogram_values_;
+  }
+
+ protected:
+  content::BrowserTaskEnvironment task_environment_;
+  TestingPrefServiceSimple local_state_;
+  scoped_refptr<BraveP3AService> service_;
+};
+
+TEST_F(BraveP3AServiceTest, CoalescesQueuedHistogramChanges) {
+  // Every histogram is changed repeatedly from its own thread pool task, the
+  // way histograms recorded off the UI thread arrive.
+  for (const char* histogram_name : kHistogramNames) {
+    base::ThreadPool::PostTask(
+        FROM_HERE,
+        base::BindOnce(
+            [](BraveP3AServiceTest* test, const char* histogram_name) {
+              for (size_t bucket = 1; bucket <= kChangesPerHistogram;
+                   bucket++) {
+                test->QueueHistogramChange(histogram_name, bucket);
+              }
+            },
+            base::Unretained(this), histogram_name));
+  }
+  base::ThreadPoolInstance::Get()->FlushForTesting();
+
+  // All of the changes are handed to the UI thread by a single task.
+  EXPECT_EQ(task_environment_.GetPendingMainThreadTaskCount(), 1u);
+  EXPECT_TRUE(histogram_values().empty());
+
+  task_environment_.RunUntilIdle();
+  ASSERT_EQ(histogram_values().size(), std::size(kHistogramNames));
+  for (const char* histogram_name : kHistogramNames) {
+    auto it = histogram_values().find(histogram_name);
+    ASSERT_NE(it, histogram_values().end()) << histogram_name;
+    EXPECT_EQ(it->second, kChangesPerHistogram) << histogram_name;
+  }
+
+  // A change arriving after the batch was handled posts a new task.
+  QueueHistogramChange(kHistogramNames[0], 1);
+  EXPECT_EQ(task_environment_.GetPendingMainThreadTaskCount(), 1u);
+  task_environment_.RunUntilIdle();
+  EXPECT_EQ(histogram_values().at(kHistogramNames[0]), 1u);
+}
+
+}  // namespace brave